@@ -0,0 +1,160 @@
+#include "core/KitchenManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+    const int KITCHEN_CAPACITY = 10;
+    const int EXCLUDED_KITCHENS = 4;
+    const int DEFAULT_OPERATIONS = 20000;
+    const int FLEET_SIZES[] = {16, 256, 1000, 4000, 10000};
+    
+    struct SimulatedKitchen {
+        int id;
+        int credits;
+        long long work;
+        bool blocked;
+        std::vector<int> inFlight;
+        
+        KitchenLoad getLoad() const {
+            return {CookableNow, blocked, work, id};
+        }
+    };
+    
+    using LoadIndex = IndexedMinHeap<SimulatedKitchen*, KitchenLoad>;
+    
+    bool isExcluded(const std::vector<SimulatedKitchen*>& excluded, SimulatedKitchen* kitchen) {
+        return std::find(excluded.begin(), excluded.end(), kitchen) != excluded.end();
+    }
+    
+    SimulatedKitchen* scanForBest(std::vector<SimulatedKitchen>& kitchens,
+                                  const std::vector<SimulatedKitchen*>& excluded) {
+        SimulatedKitchen* best = nullptr;
+        
+        for (auto& kitchen : kitchens) {
+            if (kitchen.credits <= 0 || isExcluded(excluded, &kitchen)) {
+                continue;
+            }
+            if (!best || kitchen.getLoad() < best->getLoad()) {
+                best = &kitchen;
+            }
+        }
+        return best;
+    }
+    
+    SimulatedKitchen* searchIndex(const LoadIndex& index, const std::vector<SimulatedKitchen*>& excluded) {
+        SimulatedKitchen* best = nullptr;
+        index.findMin([&excluded](SimulatedKitchen* kitchen) {
+            return !isExcluded(excluded, kitchen);
+        }, best);
+        return best;
+    }
+    
+    void refresh(LoadIndex& index, SimulatedKitchen* kitchen) {
+        if (kitchen->credits <= 0) {
+            index.erase(kitchen);
+        } else {
+            index.set(kitchen, kitchen->getLoad());
+        }
+    }
+    
+    struct RunResult {
+        double nanosPerOperation;
+        long long dispatches;
+        long long checksum;
+    };
+    
+    RunResult run(int fleetSize, int operations, bool useIndex, int excludedCount) {
+        std::vector<SimulatedKitchen> kitchens(fleetSize);
+        LoadIndex index;
+        
+        for (int i = 0; i < fleetSize; ++i) {
+            kitchens[i] = {i + 1, KITCHEN_CAPACITY, 0, false, {}};
+            refresh(index, &kitchens[i]);
+        }
+        
+        std::mt19937 random(42);
+        std::vector<SimulatedKitchen*> busy;
+        std::vector<SimulatedKitchen*> excluded;
+        RunResult result = {0.0, 0, 0};
+        
+        auto start = std::chrono::steady_clock::now();
+        
+        for (int operation = 0; operation < operations; ++operation) {
+            if (busy.empty() || random() % 100 < 55) {
+                excluded.clear();
+                while (static_cast<int>(excluded.size()) < excludedCount) {
+                    SimulatedKitchen* best = useIndex ? searchIndex(index, excluded) : scanForBest(kitchens, excluded);
+                    if (!best) {
+                        break;
+                    }
+                    excluded.push_back(best);
+                }
+                
+                SimulatedKitchen* kitchen = useIndex ? searchIndex(index, excluded) : scanForBest(kitchens, excluded);
+                if (kitchen) {
+                    int cookingTime = 1 + random() % 4;
+                    --kitchen->credits;
+                    kitchen->work += cookingTime;
+                    kitchen->inFlight.push_back(cookingTime);
+                    busy.push_back(kitchen);
+                    refresh(index, kitchen);
+                    result.checksum += kitchen->id;
+                    ++result.dispatches;
+                    continue;
+                }
+            }
+            
+            size_t slot = random() % busy.size();
+            SimulatedKitchen* kitchen = busy[slot];
+            busy[slot] = busy.back();
+            busy.pop_back();
+            
+            ++kitchen->credits;
+            kitchen->work -= kitchen->inFlight.back();
+            kitchen->inFlight.pop_back();
+            refresh(index, kitchen);
+            
+            if (operation % 1000 == 0) {
+                SimulatedKitchen& flipped = kitchens[random() % fleetSize];
+                flipped.blocked = !flipped.blocked;
+                refresh(index, &flipped);
+            }
+        }
+        
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        result.nanosPerOperation = std::chrono::duration<double, std::nano>(elapsed).count() / operations;
+        return result;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int operations = argc > 1 ? std::atoi(argv[1]) : DEFAULT_OPERATIONS;
+    bool mismatch = false;
+    
+    std::printf("%d operations (55%% dispatches), capacity %d per kitchen\n", operations, KITCHEN_CAPACITY);
+    std::printf("%9s %12s %12s %18s %18s\n", "kitchens", "scan ns/op", "heap ns/op",
+                "scan excl ns/op", "heap excl ns/op");
+    
+    for (int fleetSize : FLEET_SIZES) {
+        RunResult scan = run(fleetSize, operations, false, 0);
+        RunResult heap = run(fleetSize, operations, true, 0);
+        RunResult scanExcluded = run(fleetSize, operations, false, EXCLUDED_KITCHENS);
+        RunResult heapExcluded = run(fleetSize, operations, true, EXCLUDED_KITCHENS);
+        
+        std::printf("%9d %12.1f %12.1f %18.1f %18.1f\n", fleetSize, scan.nanosPerOperation,
+                    heap.nanosPerOperation, scanExcluded.nanosPerOperation, heapExcluded.nanosPerOperation);
+        
+        if (scan.checksum != heap.checksum || scanExcluded.checksum != heapExcluded.checksum) {
+            std::fprintf(stderr, "selection mismatch for %d kitchens\n", fleetSize);
+            mismatch = true;
+        }
+    }
+    
+    std::printf("excl: the %d best kitchens are excluded before each pick (channel-full retry path)\n",
+                EXCLUDED_KITCHENS);
+    return mismatch ? 1 : 0;
+}
@@ -0,0 +1,31 @@
+#ifndef ISCHEDULINGPOLICY_HPP
+#define ISCHEDULINGPOLICY_HPP
+
+#include "ipc/Serialization.hpp"
+#include <chrono>
+#include <cstddef>
+
+enum SchedulingPolicyKind {
+    FifoScheduling,
+    ShortestJobScheduling,
+    IngredientAwareScheduling
+};
+
+struct QueuedPizza {
+    SerializedPizza pizza;
+    std::chrono::steady_clock::time_point enqueuedAt;
+};
+
+class ISchedulingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+    
+    virtual ~ISchedulingPolicy() = default;
+    
+    virtual void push(const QueuedPizza& pizza) = 0;
+    virtual bool pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) = 0;
+    virtual size_t size() const = 0;
+    virtual SchedulingPolicyKind getKind() const = 0;
+};
+
+#endif
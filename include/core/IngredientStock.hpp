@@ -0,0 +1,45 @@
+#ifndef INGREDIENTSTOCK_HPP
+#define INGREDIENTSTOCK_HPP
+
+#include "pizza/PizzaType.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+class IngredientStock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    mutable std::array<std::atomic<int>, INGREDIENT_COUNT> _counts;
+    mutable std::atomic<int64_t> _creditedPeriods;
+    Clock::time_point _refillEpoch;
+    int _maxCount;
+    int _restockIntervalMs;
+
+public:
+    IngredientStock(int initialCount, int maxCount, int restockIntervalMs);
+    
+    IngredientStock(const IngredientStock&) = delete;
+    IngredientStock& operator=(const IngredientStock&) = delete;
+    
+    bool reserve(IngredientMask ingredients);
+    void release(IngredientMask ingredients);
+    bool canSupply(IngredientMask ingredients) const;
+    IngredientMask getAvailableMask() const;
+    void reset(int count);
+    
+    int getCount(Ingredient ingredient) const;
+    std::array<int, INGREDIENT_COUNT> snapshot() const;
+    int getRestockInterval() const;
+    
+    static int indexOf(Ingredient ingredient);
+
+private:
+    void accrue() const;
+    bool tryTake(int index);
+    void give(int index, int amount) const;
+};
+
+#endif
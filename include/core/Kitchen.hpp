@@ -3,42 +3,75 @@
 
 #include "IKitchen.hpp"
 #include "pizza/Pizza.hpp"
-#include "threading/ThreadPool.hpp"
+#include "OvenScheduler.hpp"
+#include "IngredientStock.hpp"
+#include "KitchenMetrics.hpp"
+#include "SchedulingPolicyFactory.hpp"
 #include "threading/Mutex.hpp"
-#include "ipc/PipeIPC.hpp"
+#include "ipc/IPPC.hpp"
+#include "ipc/MessageDispatcher.hpp"
 #include "utils/Timer.hpp"
-#include <queue>
-#include <map>
 #include <memory>
 #include <atomic>
-#include <thread>
 #include <vector>
 
+constexpr int DEFAULT_STATUS_WINDOW_MS = 5;
+
+enum KitchenEvent {
+    IPCEvent,
+    IPCWriteEvent,
+    CookEvent,
+    RestockEvent,
+    IdleCheckEvent,
+    StatusPushEvent
+};
+
+struct BlockedPizza {
+    QueuedPizza queued;
+    IngredientMask missing;
+};
+
 class Kitchen : public IKitchen {
 private:
     int _id;
     int _numCooks;
     double _multiplier;
     int _restockTime;
+    int _statusWindowMs;
     
-    std::unique_ptr<ThreadPool> _threadPool;
-    std::queue<SerializedPizza> _pizzaQueue;
-    std::map<Ingredient, int> _ingredients;
+    std::unique_ptr<OvenScheduler> _oven;
+    std::unique_ptr<ISchedulingPolicy> _pizzaQueue;
+    IngredientStock _stock;
+    std::vector<BlockedPizza> _blockedPizzas;
+    std::vector<SerializedPizza> _completedPizzas;
+    KitchenMetrics _metrics;
+    KitchenStatus _publishedStatus;
     
     Mutex _queueMutex;
-    Mutex _ingredientMutex;
+    Mutex _completedMutex;
     
-    std::unique_ptr<PipeIPC> _ipc;
+    std::unique_ptr<IIPC> _ipc;
+    IPCMessage _incomingMessage;
+    MessageDispatcher<> _dispatcher;
     std::atomic<bool> _active;
     std::atomic<int> _activeCooks;
-    std::atomic<int> _pendingPizzas;
     
     Timer _lastActivityTimer;
-    std::thread _restockThread;
-    std::thread _communicationThread;
+    
+    int _epollFd;
+    int _cookEventFd;
+    int _restockTimerFd;
+    int _idleTimerFd;
+    int _statusTimerFd;
+    bool _watchingWrite;
+    bool _restockTimerArmed;
+    bool _statusTimerArmed;
+    bool _metricsDirty;
 
 public:
-    Kitchen(int id, int numCooks, double multiplier, int restockTime);
+    Kitchen(int id, int numCooks, double multiplier, int restockTime,
+            SchedulingPolicyKind scheduling = FifoScheduling,
+            int statusWindowMs = DEFAULT_STATUS_WINDOW_MS);
     ~Kitchen();
     
     Kitchen(const Kitchen&) = delete;
@@ -54,37 +87,43 @@ public:
     void updateLastActivity() override;
     bool shouldClose() const override;
     
-    void setIPC(std::unique_ptr<PipeIPC> ipc);
+    void setIPC(std::unique_ptr<IIPC> ipc);
     void runAsChildProcess();
     
-    void incrementPendingPizzas();
-    void decrementPendingPizzas();
-    int getPendingPizzaCount() const;
-    void decrementQueueSize();
 
 private:
+    void registerMessageHandlers();
     void initializeKitchenProcess();
-    void startRestockThread();
+    void setupEventLoop();
+    void closeEventLoop();
     void cleanupKitchenProcess();
     
     void runMainProcessLoop();
+    void handleEvent(KitchenEvent event, uint32_t events);
+    void updateWriteInterest();
     bool processIncomingMessages();
     void processPizzaQueue();
-    void sendPeriodicStatus(int loopCount);
+    void startUnblockedPizzas();
+    void blockPizza(const QueuedPizza& queued);
+    void wakeBlockedPizzas();
+    void updateRestockTimer();
+    void flushCompletedPizzas();
+    void announceReady();
+    void publishFullStatus();
+    void scheduleStatusPush();
+    void cancelStatusPush();
+    void publishStatusDelta();
+    void publishMetrics();
+    void signalCookFinished();
     
-    bool handlePizzaMessage(const std::string& message);
-    bool handleStatusMessage(const std::string& message);
+    bool handlePizzaMessage(const IPCMessage& message);
+    bool handleStatusMessage(const IPCMessage& message);
     
-    void cookPizza(const SerializedPizza& pizza);
-    void removePizzaFromQueue();
+    bool cookPizza(const QueuedPizza& queued);
+    void finishPizza(const SerializedPizza& pizza, OvenScheduler::Clock::time_point startedAt);
     
-    void restockIngredients();
-    void restockLoop();
-    bool hasIngredients(const SerializedPizza& pizza);
-    void consumeIngredients(const SerializedPizza& pizza);
+    bool reserveIngredients(const SerializedPizza& pizza);
     void initializeIngredients();
-    
-    void communicateWithReception();
 };
 
 #endif
\ No newline at end of file
@@ -2,81 +2,189 @@
 #define KITCHENMANAGER_HPP
 
 #include "Kitchen.hpp"
+#include "ipc/IPCFactory.hpp"
+#include "ipc/MessageDispatcher.hpp"
+#include "ipc/PendingRequests.hpp"
 #include "threading/Mutex.hpp"
+#include "utils/IndexedMinHeap.hpp"
 #include <vector>
 #include <memory>
 #include <map>
+#include <array>
+#include <future>
+#include <functional>
+#include <chrono>
+
+enum KitchenState {
+    SpawningKitchen,
+    ReadyKitchen,
+    DrainingKitchen,
+    DeadKitchen
+};
 
 struct KitchenProcess {
     std::unique_ptr<Kitchen> kitchen;
-    std::unique_ptr<PipeIPC> ipc;
+    std::unique_ptr<IIPC> ipc;
     pid_t pid;
-    bool active;
+    KitchenState state;
+    std::chrono::steady_clock::time_point spawnedAt;
+    KitchenStatus status;
+    KitchenMetricsSnapshot metrics;
+    bool hasMetrics;
+    int credits;
+    long long inFlightWork;
+    std::array<int, INGREDIENT_COUNT> stockEstimate;
+    bool warm;
+    std::vector<SerializedPizza> unconfirmedPizzas;
+    
+    KitchenProcess(std::unique_ptr<Kitchen> k, std::unique_ptr<IIPC> i, pid_t p, int c);
+};
+
+enum StockReadiness {
+    CookableNow,
+    CookableAfterRestock,
+    NotCookable
+};
+
+struct KitchenLoad {
+    StockReadiness readiness;
+    bool degraded;
+    long long work;
+    int kitchenId;
     
-    KitchenProcess(std::unique_ptr<Kitchen> k, std::unique_ptr<PipeIPC> i, pid_t p);
+    bool operator<(const KitchenLoad& other) const;
 };
 
+struct PizzaBatch {
+    KitchenProcess* kitchenProcess;
+    std::vector<size_t> pizzaIndexes;
+};
+
+constexpr int DEFAULT_WARM_KITCHENS = 1;
+
 class KitchenManager {
+public:
+    using StatusCallback = std::function<void(bool, const KitchenStatus&)>;
+
 private:
     std::vector<std::unique_ptr<KitchenProcess>> _kitchens;
     int _numCooksPerKitchen;
     double _multiplier;
     int _restockTime;
     int _nextKitchenId;
+    IPCTransport _transport;
+    SchedulingPolicyKind _scheduling;
+    int _statusWindowMs;
+    int _warmKitchenTarget;
+    int _epollFd;
+    int _warmPoolTimerFd;
+    bool _warmPoolMaintenanceDue;
+    std::chrono::steady_clock::time_point _lastDispatchAt;
+    IPCMessage _incomingMessage;
+    MessageDispatcher<KitchenProcess*> _dispatcher;
+    PendingRequests _pendingRequests;
+    std::vector<SerializedPizza> _rejectedPizzas;
+    std::array<IndexedMinHeap<KitchenProcess*, KitchenLoad>, PIZZA_TYPE_COUNT> _loadIndexes;
     
     Mutex _kitchensMutex;
 
 public:
-    KitchenManager(int numCooksPerKitchen, double multiplier, int restockTime);
+    KitchenManager(int numCooksPerKitchen, double multiplier, int restockTime,
+                   IPCTransport transport = PipeTransport,
+                   SchedulingPolicyKind scheduling = FifoScheduling,
+                   int statusWindowMs = DEFAULT_STATUS_WINDOW_MS,
+                   int warmKitchens = DEFAULT_WARM_KITCHENS);
     ~KitchenManager();
     
     KitchenManager(const KitchenManager&) = delete;
     KitchenManager& operator=(const KitchenManager&) = delete;
     
     bool distributePizza(const SerializedPizza& pizza);
+    std::vector<bool> distributePizzas(const std::vector<SerializedPizza>& pizzas);
     void createNewKitchen();
+    int getEventFd() const;
     void closeInactiveKitchens();
-    void displayStatus() const;
+    void displayStatus(const std::vector<KitchenStatus>& statuses) const;
     void checkForCompletedPizzas();
     
+    bool requestKitchenStatus(int kitchenId, StatusCallback callback);
+    std::future<KitchenStatus> requestKitchenStatus(int kitchenId);
+    std::vector<KitchenStatus> collectKitchenStatuses();
     std::vector<KitchenStatus> getAllKitchenStatuses() const;
+    std::vector<KitchenMetricsSnapshot> getAllKitchenMetrics() const;
     int getKitchenCount() const;
+    int getWarmKitchenCount() const;
     void cleanup();
 
 private:
-    bool sendPizzaToKitchen(int kitchenIndex, const SerializedPizza& pizza);
-    bool sendPizzaViaIPC(KitchenProcess* kitchenProcess, const SerializedPizza& pizza);
+    std::vector<bool> routePizzas(const std::vector<SerializedPizza>& pizzas);
+    void redispatchRejectedPizzas();
+    std::vector<size_t> dispatchPizzas(const std::vector<SerializedPizza>& pizzas,
+                                       const std::vector<size_t>& pizzaIndexes,
+                                       std::vector<KitchenProcess*>& fullKitchens,
+                                       std::vector<bool>& results);
+    KitchenProcess* selectKitchen(const SerializedPizza& pizza, const std::vector<KitchenProcess*>& excluded);
+    void addToBatch(std::vector<PizzaBatch>& batches, KitchenProcess* kitchenProcess, size_t pizzaIndex);
+    bool sendPizzasViaIPC(KitchenProcess* kitchenProcess, const std::vector<SerializedPizza>& pizzas,
+                          const std::vector<size_t>& pizzaIndexes);
+    
+    void spawnKitchen(bool warm);
+    KitchenProcess* promoteWarmKitchen();
+    int countWarmKitchens() const;
+    void maintainWarmPool();
+    void retireSurplusWarmKitchens(int limit);
+    void scheduleWarmPoolMaintenance(int delayMs);
     
     pid_t forkKitchenProcess(std::unique_ptr<Kitchen> kitchen, 
-                            std::unique_ptr<PipeIPC> ipc, int kitchenId);
+                            std::unique_ptr<IIPC> ipc, int kitchenId);
     void setupChildProcess(std::unique_ptr<Kitchen> kitchen, 
-                          std::unique_ptr<PipeIPC> ipc, int kitchenId);
+                          std::unique_ptr<IIPC> ipc, int kitchenId);
     void setupParentProcess(std::unique_ptr<Kitchen> kitchen, 
-                           std::unique_ptr<PipeIPC> ipc, pid_t pid);
+                           std::unique_ptr<IIPC> ipc, pid_t pid);
+    
+    void registerMessageHandlers();
+    void registerKitchen(KitchenProcess* kitchenProcess);
+    void unregisterKitchen(KitchenProcess* kitchenProcess);
     
-    bool shouldCloseKitchen(const std::unique_ptr<KitchenProcess>& kitchenProcess);
+    void drainKitchen(KitchenProcess* kitchenProcess);
+    void terminateDrainedKitchens();
     void terminateKitchenProcess(const std::unique_ptr<KitchenProcess>& kitchenProcess);
     void waitForKitchenTermination(pid_t pid);
     
-    int findBestKitchen() const;
+    KitchenProcess* findBestKitchen(const SerializedPizza& pizza, const std::vector<KitchenProcess*>& excluded) const;
+    void refreshKitchenLoad(KitchenProcess* kitchenProcess);
+    StockReadiness getStockReadiness(const KitchenProcess* kitchenProcess, IngredientMask recipe) const;
+    void adjustStockEstimate(KitchenProcess* kitchenProcess, PizzaType type, int amount);
     void cleanupDeadKitchens();
-    bool isKitchenReady(KitchenProcess* kitchenProcess) const;
+    void requeueUnconfirmedPizzas(KitchenProcess* kitchenProcess);
+    bool isKitchenReachable(KitchenProcess* kitchenProcess) const;
+    void flushPendingOutput();
+    int waitForKitchenMessages(int timeoutMs);
     void processKitchenMessages(KitchenProcess* kitchenProcess);
-    std::string receiveKitchenMessage(KitchenProcess* kitchenProcess) const;
-    void handleKitchenMessage(const std::string& message, int kitchenId);
-    void handleCompletedPizza(const std::string& pizzaData, int kitchenId);
+    bool receiveKitchenMessage(KitchenProcess* kitchenProcess, IPCMessage& message) const;
+    bool handleCompletedPizza(const IPCMessage& message, KitchenProcess* kitchenProcess);
+    bool handleRejectedPizza(const IPCMessage& message, KitchenProcess* kitchenProcess);
+    bool handleReadyMessage(KitchenProcess* kitchenProcess);
+    void consumeCredit(KitchenProcess* kitchenProcess, const SerializedPizza& pizza);
+    void returnCredit(KitchenProcess* kitchenProcess, int cookingTime);
+    int getKitchenCapacity() const;
+    bool handleStatusMessage(const IPCMessage& message, KitchenProcess* kitchenProcess);
+    bool handleStatusDeltaMessage(const IPCMessage& message, KitchenProcess* kitchenProcess);
+    bool handleMetricsMessage(const IPCMessage& message, KitchenProcess* kitchenProcess);
     
     void displayStatusHeader() const;
     void displayNoKitchensMessage() const;
     void displayStatusFooter() const;
-    void displayAllKitchens() const;
-    void displaySingleKitchen(KitchenProcess* kitchenProcess) const;
-    void displayKitchenInfo(const KitchenStatus& status, pid_t pid) const;
-    void displayIngredients(const std::vector<int>& ingredients) const;
+    void displayAllKitchens(const std::vector<KitchenStatus>& statuses) const;
+    void displayKitchenInfo(const KitchenStatus& status, const KitchenProcess* kitchenProcess) const;
+    void displayKitchenMetrics(const KitchenProcess* kitchenProcess) const;
+    void displayIngredients(const std::array<int, INGREDIENT_COUNT>& ingredients) const;
     
-    KitchenStatus getKitchenStatus(KitchenProcess* kitchenProcess) const;
-    bool requestKitchenStatus(KitchenProcess* kitchenProcess, KitchenStatus& status) const;
-    bool waitForStatusResponse(KitchenProcess* kitchenProcess, KitchenStatus& status) const;
+    KitchenProcess* findKitchen(int kitchenId) const;
+    uint32_t sendStatusRequest(KitchenProcess* kitchenProcess, StatusCallback callback);
+    void waitForStatusReplies(const std::vector<uint32_t>& correlationIds,
+                              std::chrono::steady_clock::time_point deadline);
+    std::vector<KitchenStatus> snapshotKitchenStatuses() const;
     KitchenStatus createFallbackStatus(int kitchenId) const;
 };
 
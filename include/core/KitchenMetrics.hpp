@@ -0,0 +1,63 @@
+#ifndef KITCHENMETRICS_HPP
+#define KITCHENMETRICS_HPP
+
+#include "ipc/Serialization.hpp"
+#include "threading/Mutex.hpp"
+#include "utils/LatencyHistogram.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+enum MetricsShard {
+    LoopShard,
+    OvenShard,
+    MetricsShardCount
+};
+
+class KitchenMetrics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Shard {
+        Mutex mutex;
+        LatencyHistogram queueWait;
+        LatencyHistogram cookTime;
+        uint64_t pizzasCompleted;
+        uint64_t starvationEvents;
+        
+        Shard();
+    };
+    
+    std::array<Shard, MetricsShardCount> _shards;
+    int _numCooks;
+    Clock::time_point _startedAt;
+    Clock::time_point _lastReportAt;
+    uint64_t _lastReportBusyMicros;
+    
+    Mutex _busyMutex;
+    int _cooking;
+    Clock::time_point _busySince;
+    uint64_t _busyMicros;
+
+public:
+    explicit KitchenMetrics(int numCooks);
+    
+    KitchenMetrics(const KitchenMetrics&) = delete;
+    KitchenMetrics& operator=(const KitchenMetrics&) = delete;
+    
+    void start();
+    
+    void recordQueueWait(MetricsShard shard, uint64_t micros);
+    void recordCookStart();
+    void recordCook(MetricsShard shard, uint64_t micros);
+    void recordStarvation(MetricsShard shard);
+    
+    void fillQueueWait(MetricsShard shard, KitchenStatus& status) const;
+    KitchenMetricsSnapshot report(int kitchenId);
+
+private:
+    uint64_t accrueBusyTime(Clock::time_point now, int cookingChange);
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef OVENSCHEDULER_HPP
+#define OVENSCHEDULER_HPP
+
+#include "threading/Mutex.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class OvenScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+
+private:
+    struct Entry {
+        Clock::time_point deadline;
+        uint64_t sequence;
+        Callback callback;
+        
+        bool operator>(const Entry& other) const;
+    };
+    
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> _entries;
+    Mutex _mutex;
+    uint64_t _nextSequence;
+    int _timerFd;
+    int _wakeFd;
+    std::atomic<bool> _running;
+    std::thread _thread;
+
+public:
+    OvenScheduler();
+    ~OvenScheduler();
+    
+    OvenScheduler(const OvenScheduler&) = delete;
+    OvenScheduler& operator=(const OvenScheduler&) = delete;
+    
+    void start();
+    void stop();
+    
+    void schedule(int delayMs, Callback callback);
+    size_t getPendingCount() const;
+
+private:
+    void timerLoop();
+    void fireExpired();
+    void armTimer(Clock::time_point deadline);
+};
+
+#endif
@@ -13,10 +13,20 @@ private:
     double _multiplier;
     int _numCooksPerKitchen;
     int _restockTime;
+    IPCTransport _transport;
+    SchedulingPolicyKind _scheduling;
+    int _statusWindowMs;
+    int _warmKitchens;
     std::atomic<bool> _running;
+    std::string _inputBuffer;
+    bool _inputClosed;
 
 public:
-    Reception(double multiplier, int numCooksPerKitchen, int restockTime);
+    Reception(double multiplier, int numCooksPerKitchen, int restockTime,
+              IPCTransport transport = PipeTransport,
+              SchedulingPolicyKind scheduling = FifoScheduling,
+              int statusWindowMs = DEFAULT_STATUS_WINDOW_MS,
+              int warmKitchens = DEFAULT_WARM_KITCHENS);
     ~Reception();
     
     Reception(const Reception&) = delete;
@@ -26,6 +36,8 @@ public:
     void stop();
     
 private:
+    bool readCommand(std::string& command);
+    void readInput();
     void processCommand(const std::string& command);
     void handleOrderCommand(const std::string& command);
     void handleStatusCommand();
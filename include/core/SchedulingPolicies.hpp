@@ -0,0 +1,43 @@
+#ifndef SCHEDULINGPOLICIES_HPP
+#define SCHEDULINGPOLICIES_HPP
+
+#include "ISchedulingPolicy.hpp"
+#include <deque>
+
+class FifoPolicy : public ISchedulingPolicy {
+private:
+    std::deque<QueuedPizza> _queue;
+
+public:
+    void push(const QueuedPizza& pizza) override;
+    bool pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) override;
+    size_t size() const override;
+    SchedulingPolicyKind getKind() const override;
+};
+
+class ShortestJobPolicy : public ISchedulingPolicy {
+private:
+    std::deque<QueuedPizza> _queue;
+    double _agingFactor;
+
+public:
+    explicit ShortestJobPolicy(double agingFactor = 1.0);
+    
+    void push(const QueuedPizza& pizza) override;
+    bool pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) override;
+    size_t size() const override;
+    SchedulingPolicyKind getKind() const override;
+};
+
+class IngredientAwarePolicy : public ISchedulingPolicy {
+private:
+    std::deque<QueuedPizza> _queue;
+
+public:
+    void push(const QueuedPizza& pizza) override;
+    bool pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) override;
+    size_t size() const override;
+    SchedulingPolicyKind getKind() const override;
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SCHEDULINGPOLICYFACTORY_HPP
+#define SCHEDULINGPOLICYFACTORY_HPP
+
+#include "ISchedulingPolicy.hpp"
+#include <memory>
+#include <string>
+
+class SchedulingPolicyFactory {
+public:
+    static std::unique_ptr<ISchedulingPolicy> createPolicy(SchedulingPolicyKind kind);
+    static SchedulingPolicyKind stringToPolicy(const std::string& str);
+    static std::string policyToString(SchedulingPolicyKind kind);
+};
+
+#endif
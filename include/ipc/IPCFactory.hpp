@@ -0,0 +1,21 @@
+#ifndef IPCFACTORY_HPP
+#define IPCFACTORY_HPP
+
+#include "IPPC.hpp"
+#include <memory>
+#include <string>
+
+enum IPCTransport {
+    PipeTransport,
+    ShmRingTransport,
+    SeqPacketTransport
+};
+
+class IPCFactory {
+public:
+    static std::unique_ptr<IIPC> createIPC(IPCTransport transport);
+    static IPCTransport stringToTransport(const std::string& str);
+    static std::string transportToString(IPCTransport transport);
+};
+
+#endif
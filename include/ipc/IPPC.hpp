@@ -2,16 +2,29 @@
 #define IPPC_HPP
 
 #include "Serialization.hpp"
+#include "Message.hpp"
 #include <string>
+#include <vector>
 
 class IIPC {
 public:
     virtual ~IIPC() = default;
     
+    virtual bool create() = 0;
+    virtual void setupParent() = 0;
+    virtual void setupChild() = 0;
+    
     virtual bool send(const std::string& message) = 0;
-    virtual std::string receive() = 0;
+    virtual bool sendBatch(const std::vector<std::string>& messages) = 0;
+    virtual bool receive(IPCMessage& message) = 0;
     virtual bool isReady() const = 0;
     virtual void close() = 0;
+    virtual int getReadFd() const = 0;
+    virtual int getWriteFd() const = 0;
+    
+    virtual bool flush() = 0;
+    virtual bool hasPendingOutput() const = 0;
+    virtual bool isChannelFull() const = 0;
     
     virtual IIPC& operator<<(const SerializedPizza& pizza) = 0;
     virtual IIPC& operator>>(SerializedPizza& pizza) = 0;
@@ -19,4 +32,4 @@ public:
     virtual IIPC& operator>>(KitchenStatus& status) = 0;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,56 @@
+#ifndef MESSAGE_HPP
+#define MESSAGE_HPP
+
+#include "Serialization.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum MessageType {
+    UnknownMessage,
+    PizzaMessage,
+    StatusMessage,
+    CompletedMessage,
+    StatusRequestMessage,
+    StatusDeltaMessage,
+    MetricsMessage,
+    RejectedMessage,
+    ReadyMessage,
+    MessageTypeCount
+};
+
+constexpr size_t MESSAGE_HEADER_SIZE = 12;
+
+class IPCMessage {
+private:
+    std::vector<char> _buffer;
+    size_t _size;
+    MessageType _type;
+    uint32_t _correlationId;
+
+public:
+    IPCMessage();
+    
+    char* resize(size_t size);
+    void assign(const char* data, size_t size);
+    void parse();
+    void clear();
+    
+    bool empty() const;
+    MessageType getType() const;
+    uint32_t getCorrelationId() const;
+    const char* getPayload() const;
+    size_t getPayloadSize() const;
+    
+    static std::string encode(MessageType type, uint32_t correlationId = 0);
+    static std::string encode(MessageType type, const SerializedPizza& pizza, uint32_t correlationId = 0);
+    static std::string encode(MessageType type, const KitchenStatus& status, uint32_t correlationId = 0);
+    static std::string encode(MessageType type, const StatusDelta& delta, uint32_t correlationId = 0);
+    static std::string encode(MessageType type, const KitchenMetricsSnapshot& metrics, uint32_t correlationId = 0);
+
+private:
+    static std::string encodeHeader(MessageType type, size_t payloadSize, uint32_t correlationId);
+};
+
+#endif
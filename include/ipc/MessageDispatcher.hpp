@@ -0,0 +1,40 @@
+#ifndef MESSAGEDISPATCHER_HPP
+#define MESSAGEDISPATCHER_HPP
+
+#include "Message.hpp"
+#include <array>
+#include <functional>
+
+template<typename... Context>
+class MessageDispatcher {
+public:
+    using Handler = std::function<bool(const IPCMessage&, Context...)>;
+
+private:
+    std::array<Handler, MessageTypeCount> _handlers;
+
+public:
+    MessageDispatcher() = default;
+    
+    MessageDispatcher(const MessageDispatcher&) = delete;
+    MessageDispatcher& operator=(const MessageDispatcher&) = delete;
+    
+    void registerHandler(MessageType type, Handler handler);
+    bool dispatch(const IPCMessage& message, Context... context) const;
+};
+
+template<typename... Context>
+void MessageDispatcher<Context...>::registerHandler(MessageType type, Handler handler) {
+    _handlers[type] = std::move(handler);
+}
+
+template<typename... Context>
+bool MessageDispatcher<Context...>::dispatch(const IPCMessage& message, Context... context) const {
+    const Handler& handler = _handlers[message.getType()];
+    if (!handler) {
+        return false;
+    }
+    return handler(message, context...);
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef OUTBOUNDQUEUE_HPP
+#define OUTBOUNDQUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr size_t OUTBOUND_QUEUE_CAPACITY = 256 * 1024;
+
+class OutboundQueue {
+private:
+    std::vector<char> _buffer;
+    size_t _start;
+    size_t _capacity;
+
+public:
+    explicit OutboundQueue(size_t capacity = OUTBOUND_QUEUE_CAPACITY);
+    
+    bool empty() const;
+    size_t size() const;
+    bool canAccept(size_t bytes) const;
+    
+    void append(const void* data, size_t size);
+    void appendFrame(const std::string& message);
+    
+    const char* data() const;
+    bool peekFrame(const char*& payload, uint32_t& length) const;
+    void consume(size_t bytes);
+    void clear();
+    
+    static size_t frameSize(const std::string& message);
+};
+
+#endif
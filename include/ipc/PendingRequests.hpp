@@ -0,0 +1,44 @@
+#ifndef PENDINGREQUESTS_HPP
+#define PENDINGREQUESTS_HPP
+
+#include "Message.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+class PendingRequests {
+public:
+    using Callback = std::function<void(const IPCMessage*)>;
+
+private:
+    struct Request {
+        int owner;
+        std::chrono::steady_clock::time_point deadline;
+        Callback callback;
+    };
+    
+    std::unordered_map<uint32_t, Request> _requests;
+    uint32_t _nextId;
+
+public:
+    PendingRequests();
+    
+    PendingRequests(const PendingRequests&) = delete;
+    PendingRequests& operator=(const PendingRequests&) = delete;
+    
+    uint32_t add(int owner, int timeoutMs, Callback callback);
+    bool complete(const IPCMessage& message);
+    void cancel(uint32_t correlationId);
+    void cancelOwner(int owner);
+    void expire();
+    
+    bool contains(uint32_t correlationId) const;
+    bool empty() const;
+    size_t size() const;
+
+private:
+    void finish(std::unordered_map<uint32_t, Request>::iterator it, const IPCMessage* response);
+};
+
+#endif
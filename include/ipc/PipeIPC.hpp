@@ -2,7 +2,10 @@
 #define PIPEIPC_HPP
 
 #include "IPPC.hpp"
+#include "OutboundQueue.hpp"
 #include <unistd.h>
+#include <sys/uio.h>
+#include <vector>
 
 class PipeIPC : public IIPC {
 private:
@@ -12,6 +15,11 @@ private:
     int _childToParentWrite;
     bool _isParent;
     bool _closed;
+    std::vector<char> _inputBuffer;
+    size_t _inputStart;
+    size_t _inputEnd;
+    OutboundQueue _outputQueue;
+    bool _channelFull;
 
 public:
     PipeIPC();
@@ -21,13 +29,21 @@ public:
     PipeIPC& operator=(const PipeIPC&) = delete;
     
     bool createPipes();
-    void setupParent();
-    void setupChild();
+    bool create() override;
+    void setupParent() override;
+    void setupChild() override;
     
     bool send(const std::string& message) override;
-    std::string receive() override;
+    bool sendBatch(const std::vector<std::string>& messages) override;
+    bool receive(IPCMessage& message) override;
     bool isReady() const override;
     void close() override;
+    int getReadFd() const override;
+    int getWriteFd() const override;
+    
+    bool flush() override;
+    bool hasPendingOutput() const override;
+    bool isChannelFull() const override;
     
     IIPC& operator<<(const SerializedPizza& pizza) override;
     IIPC& operator>>(SerializedPizza& pizza) override;
@@ -35,8 +51,11 @@ public:
     IIPC& operator>>(KitchenStatus& status) override;
 
 private:
-    bool writeData(int fd, const void* data, size_t size);
-    bool readData(int fd, void* data, size_t size);
+    bool sendFrames(const std::string* messages, size_t count);
+    bool writeVector(int fd, struct iovec* iov, int count);
+    bool fillInputBuffer(int fd);
+    bool extractFrame(IPCMessage& message);
+    void setNonBlocking(int fd);
 };
 
 #endif
\ No newline at end of file
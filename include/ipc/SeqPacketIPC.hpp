@@ -0,0 +1,62 @@
+#ifndef SEQPACKETIPC_HPP
+#define SEQPACKETIPC_HPP
+
+#include "IPPC.hpp"
+#include "OutboundQueue.hpp"
+#include <sys/socket.h>
+#include <vector>
+
+constexpr size_t SEQPACKET_MAX_MESSAGE_SIZE = 4096;
+constexpr unsigned int SEQPACKET_RECEIVE_BATCH = 32;
+
+class SeqPacketIPC : public IIPC {
+private:
+    int _parentSocket;
+    int _childSocket;
+    bool _isParent;
+    bool _closed;
+    
+    std::vector<char> _receiveBuffer;
+    std::vector<struct mmsghdr> _receiveHeaders;
+    std::vector<struct iovec> _receiveVectors;
+    unsigned int _receivedCount;
+    unsigned int _receivedIndex;
+    OutboundQueue _outputQueue;
+    bool _channelFull;
+
+public:
+    SeqPacketIPC();
+    ~SeqPacketIPC();
+    
+    SeqPacketIPC(const SeqPacketIPC&) = delete;
+    SeqPacketIPC& operator=(const SeqPacketIPC&) = delete;
+    
+    bool create() override;
+    void setupParent() override;
+    void setupChild() override;
+    
+    bool send(const std::string& message) override;
+    bool sendBatch(const std::vector<std::string>& messages) override;
+    bool receive(IPCMessage& message) override;
+    bool isReady() const override;
+    void close() override;
+    int getReadFd() const override;
+    int getWriteFd() const override;
+    
+    bool flush() override;
+    bool hasPendingOutput() const override;
+    bool isChannelFull() const override;
+    
+    IIPC& operator<<(const SerializedPizza& pizza) override;
+    IIPC& operator>>(SerializedPizza& pizza) override;
+    IIPC& operator<<(const KitchenStatus& status) override;
+    IIPC& operator>>(KitchenStatus& status) override;
+
+private:
+    int getSocket() const;
+    bool sendFrames(const std::string* messages, size_t count);
+    bool sendDirect(const std::string* messages, size_t count, size_t& sent);
+    bool receiveBatch();
+};
+
+#endif
@@ -2,20 +2,29 @@
 #define SERIALIZATION_HPP
 
 #include "pizza/PizzaType.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+constexpr uint8_t WIRE_FORMAT_VERSION = 3;
+
 struct SerializedPizza {
     PizzaType type;
     PizzaSize size;
     int cookingTime;
     bool isCooked;
     
+    static constexpr size_t WIRE_SIZE = 8;
+    
     SerializedPizza() = default;
     SerializedPizza(PizzaType t, PizzaSize s, int ct, bool cooked = false);
     
     std::string pack() const;
+    void packInto(char* out) const;
     void unpack(const std::string& data);
+    void unpack(const char* data, size_t length);
 };
 
 struct KitchenStatus {
@@ -24,13 +33,62 @@ struct KitchenStatus {
     int totalCooks;
     int pizzasInQueue;
     int maxCapacity;
-    std::vector<int> ingredients;
+    int blockedPizzas;
+    int schedulingPolicy;
+    int meanQueueWaitUs;
+    int p99QueueWaitUs;
+    std::array<int, INGREDIENT_COUNT> ingredients;
+    
+    static constexpr size_t WIRE_SIZE = 4 + 9 * 4 + INGREDIENT_COUNT * 4;
     
     KitchenStatus() = default;
     KitchenStatus(int id, int active, int total, int queue, int capacity);
     
     std::string pack() const;
+    void packInto(char* out) const;
     void unpack(const std::string& data);
+    void unpack(const char* data, size_t length);
+};
+
+struct KitchenMetricsSnapshot {
+    int kitchenId;
+    int uptimeMs;
+    int utilization;
+    int recentUtilization;
+    int pizzasCompleted;
+    int starvationEvents;
+    int queueWaitMeanUs;
+    int queueWaitP50Us;
+    int queueWaitP99Us;
+    int queueWaitMaxUs;
+    int cookTimeMeanUs;
+    int cookTimeP50Us;
+    int cookTimeP99Us;
+    int cookTimeMaxUs;
+    
+    static constexpr size_t WIRE_SIZE = 4 + 14 * 4;
+    
+    void packInto(char* out) const;
+    void unpack(const char* data, size_t length);
+};
+
+struct StatusDelta {
+    static constexpr int FIELD_COUNT = 5 + INGREDIENT_COUNT;
+    static constexpr size_t HEADER_SIZE = 8;
+    static constexpr size_t MAX_WIRE_SIZE = HEADER_SIZE + FIELD_COUNT * 4;
+    
+    uint32_t changed;
+    std::array<int32_t, FIELD_COUNT> values;
+    
+    StatusDelta();
+    
+    static StatusDelta between(const KitchenStatus& previous, const KitchenStatus& current);
+    bool empty() const;
+    void applyTo(KitchenStatus& status) const;
+    
+    size_t wireSize() const;
+    void packInto(char* out) const;
+    void unpack(const char* data, size_t length);
 };
 
 class Serializer {
@@ -45,6 +103,9 @@ public:
     
     static std::vector<std::string> split(const std::string& str, char delimiter);
     static std::string join(const std::vector<std::string>& vec, char delimiter);
+    
+    static void writeInt32(char* out, int32_t value);
+    static int32_t readInt32(const char* in);
 };
 
-#endif
\ No newline at end of file
+#endif
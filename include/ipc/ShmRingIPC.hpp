@@ -0,0 +1,81 @@
+#ifndef SHMRINGIPC_HPP
+#define SHMRINGIPC_HPP
+
+#include "IPPC.hpp"
+#include "OutboundQueue.hpp"
+#include "threading/Mutex.hpp"
+#include <atomic>
+#include <cstdint>
+#include <sys/types.h>
+
+constexpr uint32_t SHM_RING_CAPACITY = 64 * 1024;
+
+struct ShmRing {
+    alignas(64) std::atomic<uint32_t> head;
+    alignas(64) std::atomic<uint32_t> tail;
+    alignas(64) char data[SHM_RING_CAPACITY];
+};
+
+struct ShmRegion {
+    ShmRing parentToChild;
+    ShmRing childToParent;
+};
+
+class ShmRingIPC : public IIPC {
+private:
+    ShmRegion* _region;
+    ShmRing* _sendRing;
+    ShmRing* _receiveRing;
+    int _parentToChildEvent;
+    int _childToParentEvent;
+    pid_t _creatorPid;
+    bool _isParent;
+    bool _closed;
+    Mutex _sendMutex;
+    OutboundQueue _outputQueue;
+    bool _channelFull;
+
+public:
+    ShmRingIPC();
+    ~ShmRingIPC();
+    
+    ShmRingIPC(const ShmRingIPC&) = delete;
+    ShmRingIPC& operator=(const ShmRingIPC&) = delete;
+    
+    bool create() override;
+    void setupParent() override;
+    void setupChild() override;
+    
+    bool send(const std::string& message) override;
+    bool sendBatch(const std::vector<std::string>& messages) override;
+    bool receive(IPCMessage& message) override;
+    bool isReady() const override;
+    void close() override;
+    int getReadFd() const override;
+    int getWriteFd() const override;
+    
+    bool flush() override;
+    bool hasPendingOutput() const override;
+    bool isChannelFull() const override;
+    
+    bool waitForMessage(int timeoutMs);
+    
+    IIPC& operator<<(const SerializedPizza& pizza) override;
+    IIPC& operator>>(SerializedPizza& pizza) override;
+    IIPC& operator<<(const KitchenStatus& status) override;
+    IIPC& operator>>(KitchenStatus& status) override;
+
+private:
+    int getSendEvent() const;
+    bool sendFrames(const std::string* messages, size_t count);
+    bool push(const char* data, uint32_t length, bool& notifyPending);
+    void drainOutputQueue(bool& notifyPending);
+    uint32_t freeSpace() const;
+    void notifyPeer();
+    void clearNotification();
+    
+    static void copyIn(ShmRing* ring, uint32_t position, const void* data, uint32_t size);
+    static void copyOut(const ShmRing* ring, uint32_t position, void* data, uint32_t size);
+};
+
+#endif
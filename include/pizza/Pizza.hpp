@@ -8,7 +8,7 @@ class Pizza : public IPizza {
 private:
     PizzaType _type;
     PizzaSize _size;
-    std::vector<Ingredient> _ingredients;
+    IngredientMask _ingredients;
     int _cookingTime;
     bool _cooked;
     std::string _name;
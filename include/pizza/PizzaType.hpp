@@ -31,6 +31,25 @@ enum Ingredient {
     ChiefLove = 256
 };
 
+constexpr int INGREDIENT_COUNT = 9;
+constexpr int PIZZA_TYPE_COUNT = 4;
+
+using IngredientMask = unsigned int;
+
+struct PizzaRecipe {
+    PizzaType type;
+    const char* name;
+    IngredientMask ingredients;
+    int cookingTime;
+};
+
+constexpr PizzaRecipe PIZZA_RECIPES[PIZZA_TYPE_COUNT] = {
+    {Regina, "Regina", Dough | Tomato | Gruyere | Ham | Mushrooms, 2},
+    {Margarita, "Margarita", Dough | Tomato | Gruyere, 1},
+    {Americana, "Americana", Dough | Tomato | Gruyere | Steak, 2},
+    {Fantasia, "Fantasia", Dough | Tomato | Eggplant | GoatCheese | ChiefLove, 4}
+};
+
 struct PizzaOrder {
     PizzaType type;
     PizzaSize size;
@@ -44,7 +63,25 @@ public:
     static PizzaType stringToPizzaType(const std::string& str);
     static PizzaSize stringToPizzaSize(const std::string& str);
     static std::vector<Ingredient> getIngredientsForPizza(PizzaType type);
+    static std::vector<Ingredient> maskToIngredients(IngredientMask mask);
     static int getCookingTime(PizzaType type);
+    
+    static constexpr const PizzaRecipe* findRecipe(PizzaType type) {
+        unsigned int bits = static_cast<unsigned int>(type);
+        if (bits == 0 || (bits & (bits - 1)) != 0 || bits > static_cast<unsigned int>(Fantasia)) {
+            return nullptr;
+        }
+        return &PIZZA_RECIPES[__builtin_ctz(bits)];
+    }
+    
+    static constexpr IngredientMask getIngredientMask(PizzaType type) {
+        return findRecipe(type) ? findRecipe(type)->ingredients : 0;
+    }
 };
 
+static_assert(PizzaTypeHelper::findRecipe(Regina)->type == Regina, "recipe table out of order");
+static_assert(PizzaTypeHelper::findRecipe(Margarita)->type == Margarita, "recipe table out of order");
+static_assert(PizzaTypeHelper::findRecipe(Americana)->type == Americana, "recipe table out of order");
+static_assert(PizzaTypeHelper::findRecipe(Fantasia)->type == Fantasia, "recipe table out of order");
+
 #endif
\ No newline at end of file
@@ -0,0 +1,193 @@
+#ifndef INDEXEDMINHEAP_HPP
+#define INDEXEDMINHEAP_HPP
+
+#include <cstddef>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template<typename Value, typename Key>
+class IndexedMinHeap {
+private:
+    struct Entry {
+        Key key;
+        Value value;
+    };
+    
+    std::vector<Entry> _entries;
+    std::unordered_map<Value, size_t> _positions;
+
+public:
+    IndexedMinHeap() = default;
+    
+    IndexedMinHeap(const IndexedMinHeap&) = delete;
+    IndexedMinHeap& operator=(const IndexedMinHeap&) = delete;
+    
+    void set(const Value& value, const Key& key);
+    void erase(const Value& value);
+    void clear();
+    
+    bool contains(const Value& value) const;
+    bool empty() const;
+    size_t size() const;
+    const Value& top() const;
+    
+    template<typename Predicate>
+    bool findMin(Predicate accept, Value& result) const;
+
+private:
+    void siftUp(size_t position);
+    void siftDown(size_t position);
+    void swapEntries(size_t first, size_t second);
+};
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::set(const Value& value, const Key& key) {
+    auto found = _positions.find(value);
+    
+    if (found == _positions.end()) {
+        _entries.push_back({key, value});
+        _positions[value] = _entries.size() - 1;
+        siftUp(_entries.size() - 1);
+        return;
+    }
+    
+    size_t position = found->second;
+    bool decreased = key < _entries[position].key;
+    _entries[position].key = key;
+    
+    if (decreased) {
+        siftUp(position);
+    } else {
+        siftDown(position);
+    }
+}
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::erase(const Value& value) {
+    auto found = _positions.find(value);
+    if (found == _positions.end()) {
+        return;
+    }
+    
+    size_t position = found->second;
+    size_t last = _entries.size() - 1;
+    
+    if (position != last) {
+        swapEntries(position, last);
+    }
+    _entries.pop_back();
+    _positions.erase(value);
+    
+    if (position < _entries.size()) {
+        siftDown(position);
+        siftUp(position);
+    }
+}
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::clear() {
+    _entries.clear();
+    _positions.clear();
+}
+
+template<typename Value, typename Key>
+bool IndexedMinHeap<Value, Key>::contains(const Value& value) const {
+    return _positions.count(value) != 0;
+}
+
+template<typename Value, typename Key>
+bool IndexedMinHeap<Value, Key>::empty() const {
+    return _entries.empty();
+}
+
+template<typename Value, typename Key>
+size_t IndexedMinHeap<Value, Key>::size() const {
+    return _entries.size();
+}
+
+template<typename Value, typename Key>
+const Value& IndexedMinHeap<Value, Key>::top() const {
+    return _entries.front().value;
+}
+
+template<typename Value, typename Key>
+template<typename Predicate>
+bool IndexedMinHeap<Value, Key>::findMin(Predicate accept, Value& result) const {
+    if (_entries.empty()) {
+        return false;
+    }
+    if (accept(_entries.front().value)) {
+        result = _entries.front().value;
+        return true;
+    }
+    
+    auto greater = [this](size_t first, size_t second) {
+        return _entries[second].key < _entries[first].key;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> frontier(greater);
+    
+    for (size_t child = 1; child <= 2 && child < _entries.size(); ++child) {
+        frontier.push(child);
+    }
+    
+    while (!frontier.empty()) {
+        size_t position = frontier.top();
+        frontier.pop();
+        
+        if (accept(_entries[position].value)) {
+            result = _entries[position].value;
+            return true;
+        }
+        
+        for (size_t child = 2 * position + 1; child <= 2 * position + 2 && child < _entries.size(); ++child) {
+            frontier.push(child);
+        }
+    }
+    
+    return false;
+}
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::siftUp(size_t position) {
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (!(_entries[position].key < _entries[parent].key)) {
+            break;
+        }
+        swapEntries(position, parent);
+        position = parent;
+    }
+}
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::siftDown(size_t position) {
+    while (true) {
+        size_t smallest = position;
+        size_t left = 2 * position + 1;
+        size_t right = left + 1;
+        
+        if (left < _entries.size() && _entries[left].key < _entries[smallest].key) {
+            smallest = left;
+        }
+        if (right < _entries.size() && _entries[right].key < _entries[smallest].key) {
+            smallest = right;
+        }
+        if (smallest == position) {
+            break;
+        }
+        
+        swapEntries(position, smallest);
+        position = smallest;
+    }
+}
+
+template<typename Value, typename Key>
+void IndexedMinHeap<Value, Key>::swapEntries(size_t first, size_t second) {
+    std::swap(_entries[first], _entries[second]);
+    _positions[_entries[first].value] = first;
+    _positions[_entries[second].value] = second;
+}
+
+#endif
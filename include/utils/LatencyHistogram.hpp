@@ -0,0 +1,35 @@
+#ifndef LATENCYHISTOGRAM_HPP
+#define LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+class LatencyHistogram {
+private:
+    static const int SUB_BUCKET_BITS = 3;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = 64 * SUB_BUCKETS;
+    
+    std::array<uint64_t, BUCKET_COUNT> _buckets;
+    uint64_t _count;
+    uint64_t _sum;
+    uint64_t _max;
+    
+    static size_t bucketOf(uint64_t value);
+    static uint64_t bucketUpperBound(size_t bucket);
+
+public:
+    LatencyHistogram();
+    
+    void record(uint64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+    
+    uint64_t getCount() const;
+    uint64_t getMax() const;
+    double getMean() const;
+    uint64_t getPercentile(double percentile) const;
+};
+
+#endif
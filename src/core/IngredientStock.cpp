@@ -0,0 +1,118 @@
+#include "core/IngredientStock.hpp"
+#include <algorithm>
+
+IngredientStock::IngredientStock(int initialCount, int maxCount, int restockIntervalMs)
+    : _creditedPeriods(0), _maxCount(maxCount), _restockIntervalMs(std::max(restockIntervalMs, 1)) {
+    reset(initialCount);
+}
+
+bool IngredientStock::reserve(IngredientMask ingredients) {
+    IngredientMask taken = 0;
+    
+    accrue();
+    
+    for (IngredientMask remaining = ingredients; remaining != 0; remaining &= remaining - 1) {
+        int index = __builtin_ctz(remaining);
+        if (!tryTake(index)) {
+            release(taken);
+            return false;
+        }
+        taken |= 1u << index;
+    }
+    return true;
+}
+
+void IngredientStock::release(IngredientMask ingredients) {
+    for (IngredientMask remaining = ingredients; remaining != 0; remaining &= remaining - 1) {
+        give(__builtin_ctz(remaining), 1);
+    }
+}
+
+bool IngredientStock::canSupply(IngredientMask ingredients) const {
+    return (ingredients & ~getAvailableMask()) == 0;
+}
+
+IngredientMask IngredientStock::getAvailableMask() const {
+    IngredientMask available = 0;
+    
+    accrue();
+    
+    for (int index = 0; index < INGREDIENT_COUNT; ++index) {
+        if (_counts[index].load(std::memory_order_relaxed) > 0) {
+            available |= 1u << index;
+        }
+    }
+    return available;
+}
+
+void IngredientStock::reset(int count) {
+    for (auto& counter : _counts) {
+        counter.store(count, std::memory_order_relaxed);
+    }
+    _refillEpoch = Clock::now();
+    _creditedPeriods.store(0);
+}
+
+int IngredientStock::getCount(Ingredient ingredient) const {
+    accrue();
+    return _counts[indexOf(ingredient)].load(std::memory_order_relaxed);
+}
+
+std::array<int, INGREDIENT_COUNT> IngredientStock::snapshot() const {
+    std::array<int, INGREDIENT_COUNT> counts;
+    
+    accrue();
+    
+    for (int index = 0; index < INGREDIENT_COUNT; ++index) {
+        counts[index] = _counts[index].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+int IngredientStock::getRestockInterval() const {
+    return _restockIntervalMs;
+}
+
+int IngredientStock::indexOf(Ingredient ingredient) {
+    return __builtin_ctz(static_cast<unsigned int>(ingredient));
+}
+
+void IngredientStock::accrue() const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - _refillEpoch);
+    int64_t periods = elapsed.count() / _restockIntervalMs;
+    int64_t credited = _creditedPeriods.load();
+    
+    while (credited < periods) {
+        if (_creditedPeriods.compare_exchange_weak(credited, periods)) {
+            int amount = static_cast<int>(std::min<int64_t>(periods - credited, _maxCount));
+            for (int index = 0; index < INGREDIENT_COUNT; ++index) {
+                give(index, amount);
+            }
+            return;
+        }
+    }
+}
+
+bool IngredientStock::tryTake(int index) {
+    std::atomic<int>& counter = _counts[index];
+    int current = counter.load(std::memory_order_relaxed);
+    
+    while (current > 0) {
+        if (counter.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void IngredientStock::give(int index, int amount) const {
+    std::atomic<int>& counter = _counts[index];
+    int current = counter.load(std::memory_order_relaxed);
+    
+    while (current < _maxCount) {
+        int next = std::min(current + amount, _maxCount);
+        if (counter.compare_exchange_weak(current, next, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+}
@@ -2,14 +2,69 @@
 #include "utils/Logger.hpp"
 #include "utils/Exception.hpp"
 #include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <errno.h>
 #include <algorithm>
 
-Kitchen::Kitchen(int id, int numCooks, double multiplier, int restockTime)
+namespace {
+    const int MAX_KITCHEN_EVENTS = 8;
+    const int IDLE_CHECK_INTERVAL_MS = 1000;
+    const int INITIAL_INGREDIENT_STOCK = 5;
+    const int MAX_INGREDIENT_STOCK = 10;
+    
+    bool setTimerPeriod(int timerFd, int periodMs) {
+        struct itimerspec spec = {};
+        spec.it_interval.tv_sec = periodMs / 1000;
+        spec.it_interval.tv_nsec = (periodMs % 1000) * 1000000L;
+        spec.it_value = spec.it_interval;
+        
+        return timerfd_settime(timerFd, 0, &spec, nullptr) == 0;
+    }
+    
+    bool setTimerDelay(int timerFd, int delayMs) {
+        struct itimerspec spec = {};
+        spec.it_value.tv_sec = delayMs / 1000;
+        spec.it_value.tv_nsec = (delayMs % 1000) * 1000000L;
+        
+        return timerfd_settime(timerFd, 0, &spec, nullptr) == 0;
+    }
+    
+    int createPeriodicTimer(int periodMs) {
+        int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timerFd == -1) {
+            return -1;
+        }
+        
+        if (!setTimerPeriod(timerFd, periodMs)) {
+            close(timerFd);
+            return -1;
+        }
+        return timerFd;
+    }
+    
+    void drainCounter(int fd) {
+        uint64_t value;
+        while (read(fd, &value, sizeof(value)) > 0) {
+        }
+    }
+}
+
+Kitchen::Kitchen(int id, int numCooks, double multiplier, int restockTime,
+                 SchedulingPolicyKind scheduling, int statusWindowMs)
     : _id(id), _numCooks(numCooks), _multiplier(multiplier), _restockTime(restockTime),
-      _active(false), _activeCooks(0), _pendingPizzas(0) {
+      _statusWindowMs(statusWindowMs),
+      _pizzaQueue(SchedulingPolicyFactory::createPolicy(scheduling)),
+      _stock(INITIAL_INGREDIENT_STOCK, MAX_INGREDIENT_STOCK, restockTime),
+      _metrics(numCooks),
+      _active(false), _activeCooks(0),
+      _epollFd(-1), _cookEventFd(-1), _restockTimerFd(-1), _idleTimerFd(-1), _statusTimerFd(-1),
+      _watchingWrite(false), _restockTimerArmed(false), _statusTimerArmed(false),
+      _metricsDirty(false) {
     
-    _threadPool = std::make_unique<ThreadPool>(numCooks);
     initializeIngredients();
+    registerMessageHandlers();
 }
 
 Kitchen::~Kitchen() {
@@ -19,7 +74,9 @@ Kitchen::~Kitchen() {
 }
 
 bool Kitchen::canAcceptPizza() const {
-    int totalLoad = static_cast<int>(_pendingPizzas) + static_cast<int>(_activeCooks);
+    ScopedLock lock(const_cast<Mutex&>(_queueMutex));
+    
+    int totalLoad = static_cast<int>(_pizzaQueue->size() + _blockedPizzas.size()) + static_cast<int>(_activeCooks);
     return totalLoad < (2 * _numCooks);
 }
 
@@ -41,16 +98,8 @@ void Kitchen::stop() {
     
     _active = false;
     
-    if (_threadPool) {
-        _threadPool->stop();
-    }
-    
-    if (_restockThread.joinable()) {
-        _restockThread.join();
-    }
-    
-    if (_communicationThread.joinable()) {
-        _communicationThread.join();
+    if (_oven) {
+        _oven->stop();
     }
     
     if (_ipc) {
@@ -64,20 +113,13 @@ bool Kitchen::isActive() const {
 
 KitchenStatus Kitchen::getStatus() const {
     ScopedLock queueLock(const_cast<Mutex&>(_queueMutex));
-    ScopedLock ingredientLock(const_cast<Mutex&>(_ingredientMutex));
     
     KitchenStatus status(_id, static_cast<int>(_activeCooks), _numCooks, 
-                        _pizzaQueue.size(), 2 * _numCooks);
-    
-    status.ingredients.clear();
-    for (int i = 1; i <= 256; i *= 2) {
-        auto it = _ingredients.find(static_cast<Ingredient>(i));
-        if (it != _ingredients.end()) {
-            status.ingredients.push_back(it->second);
-        } else {
-            status.ingredients.push_back(0);
-        }
-    }
+                        _pizzaQueue->size(), 2 * _numCooks);
+    status.blockedPizzas = static_cast<int>(_blockedPizzas.size());
+    status.schedulingPolicy = _pizzaQueue->getKind();
+    _metrics.fillQueueWait(LoopShard, status);
+    status.ingredients = _stock.snapshot();
     
     return status;
 }
@@ -98,7 +140,7 @@ bool Kitchen::shouldClose() const {
     
     {
         ScopedLock lock(const_cast<Mutex&>(_queueMutex));
-        if (!_pizzaQueue.empty()) {
+        if (_pizzaQueue->size() > 0 || !_blockedPizzas.empty()) {
             return false;
         }
     }
@@ -106,14 +148,16 @@ bool Kitchen::shouldClose() const {
     return _lastActivityTimer.isRunning() && _lastActivityTimer.getElapsedSeconds() > 30.0;
 }
 
-void Kitchen::setIPC(std::unique_ptr<PipeIPC> ipc) {
+void Kitchen::setIPC(std::unique_ptr<IIPC> ipc) {
     _ipc = std::move(ipc);
 }
 
 void Kitchen::runAsChildProcess() {
     try {
         initializeKitchenProcess();
-        startRestockThread();
+        setupEventLoop();
+        announceReady();
+        publishFullStatus();
         runMainProcessLoop();
         cleanupKitchenProcess();
         
@@ -122,271 +166,466 @@ void Kitchen::runAsChildProcess() {
     }
 }
 
+void Kitchen::registerMessageHandlers() {
+    _dispatcher.registerHandler(PizzaMessage, [this](const IPCMessage& message) {
+        return handlePizzaMessage(message);
+    });
+    _dispatcher.registerHandler(StatusRequestMessage, [this](const IPCMessage& message) {
+        return handleStatusMessage(message);
+    });
+}
+
 void Kitchen::initializeKitchenProcess() {
     _active = true;
-    _lastActivityTimer.start();
     initializeIngredients();
+    _metrics.start();
+    _oven = std::make_unique<OvenScheduler>();
+    _oven->start();
 }
 
-void Kitchen::startRestockThread() {
-    try {
-        _restockThread = std::thread(&Kitchen::restockLoop, this);
-    } catch (const std::exception& e) {
-        LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to start restock thread: " + e.what());
+void Kitchen::setupEventLoop() {
+    _epollFd = epoll_create1(EPOLL_CLOEXEC);
+    _cookEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    _restockTimerFd = createPeriodicTimer(0);
+    _idleTimerFd = createPeriodicTimer(IDLE_CHECK_INTERVAL_MS);
+    _statusTimerFd = createPeriodicTimer(0);
+    
+    if (_epollFd == -1 || _cookEventFd == -1 || _restockTimerFd == -1 || _idleTimerFd == -1 ||
+        _statusTimerFd == -1) {
+        throw KitchenException("Kitchen " + std::to_string(_id) + " failed to create event loop");
+    }
+    
+    const std::pair<int, KitchenEvent> sources[] = {
+        {_ipc->getReadFd(), IPCEvent},
+        {_cookEventFd, CookEvent},
+        {_restockTimerFd, RestockEvent},
+        {_idleTimerFd, IdleCheckEvent},
+        {_statusTimerFd, StatusPushEvent}
+    };
+    
+    for (const auto& source : sources) {
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u32 = source.second;
+        if (epoll_ctl(_epollFd, EPOLL_CTL_ADD, source.first, &event) == -1) {
+            throw KitchenException("Kitchen " + std::to_string(_id) + " failed to watch event source");
+        }
+    }
+    
+    int writeFd = _ipc->getWriteFd();
+    if (writeFd != -1 && writeFd != _ipc->getReadFd()) {
+        struct epoll_event event = {};
+        event.data.u32 = IPCWriteEvent;
+        epoll_ctl(_epollFd, EPOLL_CTL_ADD, writeFd, &event);
+    }
+}
+
+void Kitchen::closeEventLoop() {
+    for (int* fd : {&_epollFd, &_cookEventFd, &_restockTimerFd, &_idleTimerFd, &_statusTimerFd}) {
+        if (*fd != -1) {
+            close(*fd);
+            *fd = -1;
+        }
     }
 }
 
 void Kitchen::runMainProcessLoop() {
-    int loopCount = 0;
+    struct epoll_event events[MAX_KITCHEN_EVENTS];
     
-    while (_active && loopCount < 10000) {
-        loopCount++;
+    while (_active) {
+        updateWriteInterest();
         
-        bool receivedSomething = processIncomingMessages();
-        processPizzaQueue();
-        sendPeriodicStatus(loopCount);
+        int timeoutMs = (_ipc->hasPendingOutput() && _ipc->getWriteFd() == -1) ? 1 : -1;
+        int readyCount = epoll_wait(_epollFd, events, MAX_KITCHEN_EVENTS, timeoutMs);
         
-        if (!receivedSomething && shouldClose()) {
+        if (readyCount == -1 && errno != EINTR) {
+            LOG_ERROR("Kitchen " + std::to_string(_id) + " event loop failed");
             break;
         }
         
-        Timer::sleep(receivedSomething ? 10 : 100);
+        if (_ipc->hasPendingOutput()) {
+            _ipc->flush();
+        }
+        
+        for (int i = 0; i < readyCount; ++i) {
+            handleEvent(static_cast<KitchenEvent>(events[i].data.u32), events[i].events);
+        }
+        
+        processPizzaQueue();
+        flushCompletedPizzas();
+        updateRestockTimer();
+        scheduleStatusPush();
+    }
+}
+
+void Kitchen::handleEvent(KitchenEvent event, uint32_t events) {
+    switch (event) {
+        case IPCEvent:
+            if (events & EPOLLIN) {
+                processIncomingMessages();
+            }
+            if (events & (EPOLLHUP | EPOLLERR)) {
+                processIncomingMessages();
+                _active = false;
+            }
+            break;
+        case IPCWriteEvent:
+            if (events & EPOLLERR) {
+                _active = false;
+            }
+            break;
+        case CookEvent:
+            drainCounter(_cookEventFd);
+            break;
+        case RestockEvent:
+            drainCounter(_restockTimerFd);
+            wakeBlockedPizzas();
+            break;
+        case IdleCheckEvent:
+            drainCounter(_idleTimerFd);
+            publishMetrics();
+            if (shouldClose()) {
+                _active = false;
+            }
+            break;
+        case StatusPushEvent:
+            drainCounter(_statusTimerFd);
+            _statusTimerArmed = false;
+            publishStatusDelta();
+            break;
+    }
+}
+
+void Kitchen::updateWriteInterest() {
+    int writeFd = _ipc->getWriteFd();
+    bool wantWrite = writeFd != -1 && _ipc->hasPendingOutput();
+    
+    if (wantWrite == _watchingWrite) {
+        return;
+    }
+    
+    struct epoll_event event = {};
+    if (writeFd == _ipc->getReadFd()) {
+        event.events = EPOLLIN | (wantWrite ? static_cast<uint32_t>(EPOLLOUT) : 0);
+        event.data.u32 = IPCEvent;
+    } else {
+        event.events = wantWrite ? static_cast<uint32_t>(EPOLLOUT) : 0;
+        event.data.u32 = IPCWriteEvent;
+    }
+    
+    if (epoll_ctl(_epollFd, EPOLL_CTL_MOD, writeFd, &event) == 0) {
+        _watchingWrite = wantWrite;
     }
 }
 
 bool Kitchen::processIncomingMessages() {
     bool receivedSomething = false;
     
-    if (_ipc && _ipc->isReady()) {
-        try {
-            std::string message = _ipc->receive();
-            if (!message.empty()) {
-                if (handlePizzaMessage(message) || handleStatusMessage(message)) {
-                    receivedSomething = true;
-                    updateLastActivity();
-                }
+    if (!_ipc || !_ipc->isReady()) {
+        return false;
+    }
+    
+    try {
+        while (_ipc->receive(_incomingMessage)) {
+            if (_dispatcher.dispatch(_incomingMessage)) {
+                receivedSomething = true;
             }
-        } catch (const std::exception& e) {
         }
+    } catch (const std::exception& e) {
+    }
+    
+    if (receivedSomething) {
+        updateLastActivity();
     }
     
     return receivedSomething;
 }
 
-bool Kitchen::handlePizzaMessage(const std::string& message) {
-    if (message.substr(0, 6) == "PIZZA:") {
-        try {
-            SerializedPizza pizza;
-            pizza.unpack(message.substr(6));
-            
-            {
-                ScopedLock lock(_queueMutex);
-                _pizzaQueue.push(pizza);
-            }
-            
-            return true;
-        } catch (const std::exception& e) {
-            LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to process pizza: " + e.what());
+bool Kitchen::handlePizzaMessage(const IPCMessage& message) {
+    try {
+        QueuedPizza queued;
+        queued.pizza.unpack(message.getPayload(), message.getPayloadSize());
+        queued.enqueuedAt = ISchedulingPolicy::Clock::now();
+        
+        if (!canAcceptPizza()) {
+            LOG_WARNING("Kitchen " + std::to_string(_id) + " is full, rejecting pizza");
+            return _ipc->send(IPCMessage::encode(RejectedMessage, queued.pizza));
         }
+        
+        {
+            ScopedLock lock(_queueMutex);
+            _pizzaQueue->push(queued);
+        }
+        
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to process pizza: " + e.what());
     }
     return false;
 }
 
-bool Kitchen::handleStatusMessage(const std::string& message) {
-    if (message == "STATUS_REQUEST") {
-        try {
-            KitchenStatus status = getStatus();
-            std::string statusMsg = "STATUS:" + status.pack();
-            return _ipc->send(statusMsg);
-        } catch (const std::exception& e) {
-            LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to send status: " + e.what());
+bool Kitchen::handleStatusMessage(const IPCMessage& message) {
+    try {
+        KitchenStatus status = getStatus();
+        if (!_ipc->send(IPCMessage::encode(StatusMessage, status, message.getCorrelationId()))) {
+            return false;
         }
+        
+        _publishedStatus = status;
+        cancelStatusPush();
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to send status: " + e.what());
     }
     return false;
 }
 
 void Kitchen::processPizzaQueue() {
+    startUnblockedPizzas();
+    
     while (static_cast<int>(_activeCooks) < _numCooks) {
-        SerializedPizza nextPizza;
-        bool hasPizza = false;
+        QueuedPizza nextPizza;
+        bool hasPizza;
         
         {
             ScopedLock lock(_queueMutex);
-            if (!_pizzaQueue.empty()) {
-                nextPizza = _pizzaQueue.front();
-                _pizzaQueue.pop();
-                hasPizza = true;
-            }
+            hasPizza = _pizzaQueue->pop(nextPizza, _stock.getAvailableMask(), ISchedulingPolicy::Clock::now());
         }
         
-        if (hasPizza) {
-            std::thread cookingThread([this, nextPizza]() {
-                this->cookPizza(nextPizza);
-            });
-            cookingThread.detach();
-        } else {
+        if (!hasPizza) {
             break;
         }
+        
+        if (!cookPizza(nextPizza)) {
+            blockPizza(nextPizza);
+        }
     }
 }
 
-void Kitchen::sendPeriodicStatus(int loopCount) {
-    static int lastStatusSent = 0;
+void Kitchen::startUnblockedPizzas() {
+    ScopedLock lock(_queueMutex);
     
-    if (loopCount % 100 == 0 && loopCount > lastStatusSent + 50) {
-        try {
-            if (_ipc && _ipc->isReady()) {
-                KitchenStatus status = getStatus();
-                std::string statusMsg = "STATUS:" + status.pack();
-                _ipc->send(statusMsg);
-                lastStatusSent = loopCount;
-            }
-        } catch (const std::exception& e) {
+    for (auto it = _blockedPizzas.begin(); it != _blockedPizzas.end();) {
+        if (static_cast<int>(_activeCooks) >= _numCooks) {
+            break;
+        }
+        
+        if (it->missing != 0) {
+            ++it;
+            continue;
+        }
+        
+        if (cookPizza(it->queued)) {
+            it = _blockedPizzas.erase(it);
+        } else {
+            it->missing = PizzaTypeHelper::getIngredientMask(it->queued.pizza.type) & ~_stock.getAvailableMask();
+            ++it;
         }
     }
 }
 
-void Kitchen::cleanupKitchenProcess() {
-    _active = false;
+void Kitchen::blockPizza(const QueuedPizza& queued) {
+    BlockedPizza blocked;
+    blocked.queued = queued;
+    blocked.missing = PizzaTypeHelper::getIngredientMask(queued.pizza.type) & ~_stock.getAvailableMask();
     
-    if (_restockThread.joinable()) {
-        _restockThread.join();
-    }
+    _metrics.recordStarvation(LoopShard);
+    _metricsDirty = true;
     
-    if (_ipc) {
-        _ipc->close();
+    ScopedLock lock(_queueMutex);
+    _blockedPizzas.push_back(blocked);
+}
+
+void Kitchen::wakeBlockedPizzas() {
+    IngredientMask available = _stock.getAvailableMask();
+    ScopedLock lock(_queueMutex);
+    
+    for (auto& blocked : _blockedPizzas) {
+        if (blocked.missing & available) {
+            blocked.missing = PizzaTypeHelper::getIngredientMask(blocked.queued.pizza.type) & ~available;
+        }
     }
 }
 
-void Kitchen::cookPizza(const SerializedPizza& pizza) {
-    _activeCooks++;
-    decrementPendingPizzas();
-    updateLastActivity();
+void Kitchen::updateRestockTimer() {
+    bool wantTimer;
+    
+    {
+        ScopedLock lock(_queueMutex);
+        wantTimer = !_blockedPizzas.empty();
+    }
     
-    if (!hasIngredients(pizza)) {
-        removePizzaFromQueue();
-        _activeCooks--;
+    if (wantTimer == _restockTimerArmed) {
         return;
     }
     
-    consumeIngredients(pizza);
+    if (setTimerPeriod(_restockTimerFd, wantTimer ? _stock.getRestockInterval() : 0)) {
+        _restockTimerArmed = wantTimer;
+    }
+}
+
+void Kitchen::flushCompletedPizzas() {
+    std::vector<SerializedPizza> completed;
     
-    Timer::sleep(pizza.cookingTime);
+    {
+        ScopedLock lock(_completedMutex);
+        completed.swap(_completedPizzas);
+    }
     
-    removePizzaFromQueue();
+    if (completed.empty() || !_ipc || !_ipc->isReady()) {
+        return;
+    }
     
-    std::string pizzaInfo = PizzaTypeHelper::pizzaTypeToString(pizza.type) + " " +
-                           PizzaTypeHelper::pizzaSizeToString(pizza.size);
+    _metricsDirty = true;
+    std::vector<std::string> messages;
+    messages.reserve(completed.size());
+    for (const auto& pizza : completed) {
+        messages.push_back(IPCMessage::encode(CompletedMessage, pizza));
+    }
     
-    if (_ipc && _ipc->isReady()) {
-        SerializedPizza readyPizza = pizza;
-        readyPizza.isCooked = true;
-        try {
-            std::string completedMsg = "COMPLETED:" + readyPizza.pack();
-            _ipc->send(completedMsg);
-        } catch (const std::exception& e) {
-            LOG_ERROR("Kitchen " + std::to_string(_id) + " IPC error: " + e.what());
+    try {
+        if (!_ipc->sendBatch(messages) && _ipc->isChannelFull()) {
+            ScopedLock lock(_completedMutex);
+            _completedPizzas.insert(_completedPizzas.begin(), completed.begin(), completed.end());
         }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Kitchen " + std::to_string(_id) + " IPC error: " + e.what());
     }
-    
-    _activeCooks--;
-    updateLastActivity();
 }
 
-void Kitchen::removePizzaFromQueue() {
-    ScopedLock lock(_queueMutex);
-    if (!_pizzaQueue.empty()) {
-        _pizzaQueue.pop();
+void Kitchen::publishMetrics() {
+    if (!_metricsDirty && _activeCooks == 0) {
+        return;
     }
-}
-
-void Kitchen::restockIngredients() {
-    ScopedLock lock(_ingredientMutex);
     
-    for (auto& ingredient : _ingredients) {
-        ingredient.second = std::min(ingredient.second + 1, 10);
+    if (_ipc->send(IPCMessage::encode(MetricsMessage, _metrics.report(_id)))) {
+        _metricsDirty = false;
     }
 }
 
-void Kitchen::communicateWithReception() {
-    while (_active) {
-        try {
-            if (_ipc && _ipc->isReady()) {
-                KitchenStatus status = getStatus();
-                *_ipc << status;
-            }
-        } catch (const std::exception& e) {
-            LOG_ERROR("Kitchen " + std::to_string(_id) + " communication error: " + e.what());
-        }
-        
-        Timer::sleep(1000);
+void Kitchen::announceReady() {
+    if (!_ipc->send(IPCMessage::encode(ReadyMessage))) {
+        throw KitchenException("Kitchen " + std::to_string(_id) + " could not announce readiness");
     }
 }
 
-bool Kitchen::hasIngredients(const SerializedPizza& pizza) {
-    ScopedLock lock(_ingredientMutex);
+void Kitchen::publishFullStatus() {
+    _publishedStatus = getStatus();
     
-    std::vector<Ingredient> required = PizzaTypeHelper::getIngredientsForPizza(pizza.type);
+    if (!_ipc->send(IPCMessage::encode(StatusMessage, _publishedStatus))) {
+        LOG_WARNING("Kitchen " + std::to_string(_id) + " could not publish its initial status");
+    }
+}
+
+void Kitchen::scheduleStatusPush() {
+    if (_statusTimerArmed || StatusDelta::between(_publishedStatus, getStatus()).empty()) {
+        return;
+    }
     
-    for (Ingredient ing : required) {
-        auto it = _ingredients.find(ing);
-        if (it == _ingredients.end() || it->second <= 0) {
-            return false;
-        }
+    if (_statusWindowMs <= 0) {
+        publishStatusDelta();
+        return;
     }
     
-    return true;
+    if (setTimerDelay(_statusTimerFd, _statusWindowMs)) {
+        _statusTimerArmed = true;
+    }
+}
+
+void Kitchen::cancelStatusPush() {
+    if (_statusTimerArmed && setTimerDelay(_statusTimerFd, 0)) {
+        _statusTimerArmed = false;
+    }
 }
 
-void Kitchen::consumeIngredients(const SerializedPizza& pizza) {
-    ScopedLock lock(_ingredientMutex);
+void Kitchen::publishStatusDelta() {
+    KitchenStatus status = getStatus();
+    StatusDelta delta = StatusDelta::between(_publishedStatus, status);
     
-    std::vector<Ingredient> required = PizzaTypeHelper::getIngredientsForPizza(pizza.type);
+    if (delta.empty() || !_ipc->isReady()) {
+        return;
+    }
     
-    for (Ingredient ing : required) {
-        auto it = _ingredients.find(ing);
-        if (it != _ingredients.end()) {
-            it->second = std::max(0, it->second - 1);
-        }
+    if (_ipc->send(IPCMessage::encode(StatusDeltaMessage, delta))) {
+        _publishedStatus = status;
     }
 }
 
-void Kitchen::initializeIngredients() {
-    ScopedLock lock(_ingredientMutex);
-    
-    _ingredients[Dough] = 5;
-    _ingredients[Tomato] = 5;
-    _ingredients[Gruyere] = 5;
-    _ingredients[Ham] = 5;
-    _ingredients[Mushrooms] = 5;
-    _ingredients[Steak] = 5;
-    _ingredients[Eggplant] = 5;
-    _ingredients[GoatCheese] = 5;
-    _ingredients[ChiefLove] = 5;
+void Kitchen::signalCookFinished() {
+    uint64_t value = 1;
+    if (_cookEventFd != -1 && write(_cookEventFd, &value, sizeof(value)) == -1 && errno != EAGAIN) {
+        LOG_ERROR("Kitchen " + std::to_string(_id) + " failed to signal finished cook");
+    }
 }
 
-void Kitchen::restockLoop() {
-    while (_active) {
-        Timer::sleep(_restockTime);
-        if (_active) {
-            restockIngredients();
+void Kitchen::cleanupKitchenProcess() {
+    _active = false;
+    
+    while (_activeCooks > 0) {
+        Timer::sleep(10);
+    }
+    
+    if (_oven) {
+        _oven->stop();
+    }
+    
+    flushCompletedPizzas();
+    
+    for (int attempt = 0; attempt < 100 && _ipc && _ipc->hasPendingOutput(); ++attempt) {
+        if (!_ipc->flush()) {
+            break;
         }
+        Timer::sleep(1);
+    }
+    
+    closeEventLoop();
+    
+    if (_ipc) {
+        _ipc->close();
     }
 }
 
-void Kitchen::decrementQueueSize() {
+bool Kitchen::cookPizza(const QueuedPizza& queued) {
+    const SerializedPizza& pizza = queued.pizza;
+    if (!reserveIngredients(pizza)) {
+        return false;
+    }
+    
+    _activeCooks++;
+    _metrics.recordCookStart();
+    updateLastActivity();
+    
+    OvenScheduler::Clock::time_point startedAt = OvenScheduler::Clock::now();
+    _metrics.recordQueueWait(LoopShard,
+        std::chrono::duration_cast<std::chrono::microseconds>(startedAt - queued.enqueuedAt).count());
+    _metricsDirty = true;
+    
+    _oven->schedule(pizza.cookingTime, [this, pizza, startedAt]() {
+        this->finishPizza(pizza, startedAt);
+    });
+    return true;
 }
 
-void Kitchen::incrementPendingPizzas() {
-    _pendingPizzas++;
+void Kitchen::finishPizza(const SerializedPizza& pizza, OvenScheduler::Clock::time_point startedAt) {
+    _metrics.recordCook(OvenShard,
+        std::chrono::duration_cast<std::chrono::microseconds>(OvenScheduler::Clock::now() - startedAt).count());
+    
+    {
+        SerializedPizza readyPizza = pizza;
+        readyPizza.isCooked = true;
+        ScopedLock lock(_completedMutex);
+        _completedPizzas.push_back(readyPizza);
+    }
+    
+    _activeCooks--;
+    updateLastActivity();
+    signalCookFinished();
 }
 
-void Kitchen::decrementPendingPizzas() {
-    if (_pendingPizzas > 0) {
-        _pendingPizzas--;
-    }
+bool Kitchen::reserveIngredients(const SerializedPizza& pizza) {
+    return _stock.reserve(PizzaTypeHelper::getIngredientMask(pizza.type));
 }
 
-int Kitchen::getPendingPizzaCount() const {
-    return static_cast<int>(_pendingPizzas);
-}
\ No newline at end of file
+void Kitchen::initializeIngredients() {
+    _stock.reset(INITIAL_INGREDIENT_STOCK);
+}
@@ -2,95 +2,357 @@
 #include "utils/Logger.hpp"
 #include "utils/Exception.hpp"
 #include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <poll.h>
 #include <sys/wait.h>
 #include <signal.h>
 #include <iostream>
 #include <algorithm>
-#include <climits>
 
-KitchenProcess::KitchenProcess(std::unique_ptr<Kitchen> k, std::unique_ptr<PipeIPC> i, pid_t p)
-    : kitchen(std::move(k)), ipc(std::move(i)), pid(p), active(true) {}
+namespace {
+    const int MAX_EPOLL_EVENTS = 64;
+    const int MAX_ROUTING_ATTEMPTS = 3;
+    const int STATUS_REQUEST_TIMEOUT_MS = 500;
+    const int KITCHEN_SPAWN_TIMEOUT_MS = 5000;
+    const int INGREDIENTS_PER_RESTOCK = 1;
+    const int WARM_POOL_REFILL_DELAY_MS = 1;
+    const int WARM_POOL_IDLE_MS = 60000;
+    const int IDLE_WARM_KITCHENS = 1;
+    
+    size_t recipeIndex(PizzaType type) {
+        return PizzaTypeHelper::findRecipe(type) ? __builtin_ctz(static_cast<unsigned int>(type)) : 0;
+    }
+    
+    const char* kitchenStateToString(KitchenState state) {
+        switch (state) {
+            case SpawningKitchen: return "spawning";
+            case ReadyKitchen: return "ready";
+            case DrainingKitchen: return "draining";
+            case DeadKitchen: return "dead";
+            default: return "unknown";
+        }
+    }
+}
+
+KitchenProcess::KitchenProcess(std::unique_ptr<Kitchen> k, std::unique_ptr<IIPC> i, pid_t p, int c)
+    : kitchen(std::move(k)), ipc(std::move(i)), pid(p), state(SpawningKitchen),
+      spawnedAt(std::chrono::steady_clock::now()), metrics(), hasMetrics(false),
+      credits(c), inFlightWork(0), stockEstimate(), warm(false) {}
+
+bool KitchenLoad::operator<(const KitchenLoad& other) const {
+    if (readiness != other.readiness) {
+        return readiness < other.readiness;
+    }
+    if (degraded != other.degraded) {
+        return !degraded;
+    }
+    if (work != other.work) {
+        return work < other.work;
+    }
+    return kitchenId < other.kitchenId;
+}
 
-KitchenManager::KitchenManager(int numCooksPerKitchen, double multiplier, int restockTime)
+KitchenManager::KitchenManager(int numCooksPerKitchen, double multiplier, int restockTime,
+                               IPCTransport transport, SchedulingPolicyKind scheduling,
+                               int statusWindowMs, int warmKitchens)
     : _numCooksPerKitchen(numCooksPerKitchen), _multiplier(multiplier), 
-      _restockTime(restockTime), _nextKitchenId(1) {}
+      _restockTime(restockTime), _nextKitchenId(1), _transport(transport),
+      _scheduling(scheduling), _statusWindowMs(statusWindowMs),
+      _warmKitchenTarget(warmKitchens), _warmPoolMaintenanceDue(false),
+      _lastDispatchAt(std::chrono::steady_clock::now()) {
+    
+    _epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (_epollFd == -1) {
+        throw KitchenException("Failed to create epoll instance");
+    }
+    
+    _warmPoolTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    
+    if (_warmPoolTimerFd == -1 || epoll_ctl(_epollFd, EPOLL_CTL_ADD, _warmPoolTimerFd, &event) == -1) {
+        ::close(_epollFd);
+        if (_warmPoolTimerFd != -1) {
+            ::close(_warmPoolTimerFd);
+        }
+        throw KitchenException("Failed to create warm pool timer");
+    }
+    
+    registerMessageHandlers();
+    scheduleWarmPoolMaintenance(WARM_POOL_REFILL_DELAY_MS);
+}
 
 KitchenManager::~KitchenManager() {
     cleanup();
+    ::close(_warmPoolTimerFd);
+    ::close(_epollFd);
 }
 
 bool KitchenManager::distributePizza(const SerializedPizza& pizza) {
+    return distributePizzas({pizza}).front();
+}
+
+std::vector<bool> KitchenManager::distributePizzas(const std::vector<SerializedPizza>& pizzas) {
     ScopedLock lock(_kitchensMutex);
     
     cleanupDeadKitchens();
     checkForCompletedPizzas();
     
-    int bestKitchenIndex = findBestKitchen();
+    return routePizzas(pizzas);
+}
+
+std::vector<bool> KitchenManager::routePizzas(const std::vector<SerializedPizza>& pizzas) {
+    std::vector<bool> results(pizzas.size(), false);
+    std::vector<size_t> pizzaIndexes(pizzas.size());
+    std::vector<KitchenProcess*> fullKitchens;
     
-    if (bestKitchenIndex == -1) {
-        createNewKitchen();
-        bestKitchenIndex = _kitchens.size() - 1;
+    for (size_t i = 0; i < pizzas.size(); ++i) {
+        pizzaIndexes[i] = i;
     }
     
-    return sendPizzaToKitchen(bestKitchenIndex, pizza);
+    for (int attempt = 0; attempt < MAX_ROUTING_ATTEMPTS && !pizzaIndexes.empty(); ++attempt) {
+        pizzaIndexes = dispatchPizzas(pizzas, pizzaIndexes, fullKitchens, results);
+    }
+    
+    _lastDispatchAt = std::chrono::steady_clock::now();
+    if (countWarmKitchens() < _warmKitchenTarget) {
+        scheduleWarmPoolMaintenance(WARM_POOL_REFILL_DELAY_MS);
+    }
+    
+    return results;
 }
 
-bool KitchenManager::sendPizzaToKitchen(int kitchenIndex, const SerializedPizza& pizza) {
-    if (kitchenIndex < 0 || kitchenIndex >= static_cast<int>(_kitchens.size())) {
-        return false;
+void KitchenManager::redispatchRejectedPizzas() {
+    std::vector<SerializedPizza> pizzas;
+    pizzas.swap(_rejectedPizzas);
+    
+    std::vector<bool> results = routePizzas(pizzas);
+    for (size_t i = 0; i < pizzas.size(); ++i) {
+        if (!results[i]) {
+            LOG_WARNING("Could not reroute rejected " + PizzaTypeHelper::pizzaTypeToString(pizzas[i].type) +
+                        " pizza yet, retrying on the next pump");
+            _rejectedPizzas.push_back(pizzas[i]);
+        }
     }
+}
+
+std::vector<size_t> KitchenManager::dispatchPizzas(const std::vector<SerializedPizza>& pizzas,
+                                                   const std::vector<size_t>& pizzaIndexes,
+                                                   std::vector<KitchenProcess*>& fullKitchens,
+                                                   std::vector<bool>& results) {
+    std::vector<PizzaBatch> batches;
+    std::vector<size_t> rejected;
     
-    auto& kitchenProcess = _kitchens[kitchenIndex];
+    for (size_t index : pizzaIndexes) {
+        KitchenProcess* kitchenProcess = selectKitchen(pizzas[index], fullKitchens);
+        if (!kitchenProcess) {
+            continue;
+        }
+        
+        addToBatch(batches, kitchenProcess, index);
+        consumeCredit(kitchenProcess, pizzas[index]);
+    }
     
-    if (!kitchenProcess->kitchen->canAcceptPizza()) {
+    for (const auto& batch : batches) {
+        bool sent = sendPizzasViaIPC(batch.kitchenProcess, pizzas, batch.pizzaIndexes);
+        bool channelFull = !sent && batch.kitchenProcess->ipc->isChannelFull();
+        
+        for (size_t index : batch.pizzaIndexes) {
+            results[index] = sent;
+            if (!sent) {
+                adjustStockEstimate(batch.kitchenProcess, pizzas[index].type, 1);
+                returnCredit(batch.kitchenProcess, pizzas[index].cookingTime);
+            }
+            if (channelFull) {
+                rejected.push_back(index);
+            }
+        }
+        
+        if (channelFull) {
+            fullKitchens.push_back(batch.kitchenProcess);
+        }
+    }
+    
+    return rejected;
+}
+
+KitchenProcess* KitchenManager::selectKitchen(const SerializedPizza& pizza,
+                                              const std::vector<KitchenProcess*>& excluded) {
+    KitchenProcess* kitchenProcess = findBestKitchen(pizza, excluded);
+    
+    if (!kitchenProcess ||
+        getStockReadiness(kitchenProcess, PizzaTypeHelper::getIngredientMask(pizza.type)) == NotCookable) {
+        KitchenProcess* warmKitchen = promoteWarmKitchen();
+        if (warmKitchen) {
+            kitchenProcess = warmKitchen;
+        }
+    }
+    
+    if (!kitchenProcess) {
         createNewKitchen();
-        kitchenIndex = _kitchens.size() - 1;
-        if (kitchenIndex < 0 || kitchenIndex >= static_cast<int>(_kitchens.size())) {
-            return false;
+        kitchenProcess = _kitchens.empty() ? nullptr : _kitchens.back().get();
+    }
+    
+    return kitchenProcess;
+}
+
+void KitchenManager::addToBatch(std::vector<PizzaBatch>& batches, KitchenProcess* kitchenProcess,
+                                size_t pizzaIndex) {
+    for (auto& batch : batches) {
+        if (batch.kitchenProcess == kitchenProcess) {
+            batch.pizzaIndexes.push_back(pizzaIndex);
+            return;
         }
     }
     
-    return sendPizzaViaIPC(_kitchens[kitchenIndex].get(), pizza);
+    batches.push_back({kitchenProcess, {pizzaIndex}});
 }
 
-bool KitchenManager::sendPizzaViaIPC(KitchenProcess* kitchenProcess, const SerializedPizza& pizza) {
+bool KitchenManager::sendPizzasViaIPC(KitchenProcess* kitchenProcess, const std::vector<SerializedPizza>& pizzas,
+                                      const std::vector<size_t>& pizzaIndexes) {
     if (!kitchenProcess->ipc || !kitchenProcess->ipc->isReady()) {
         return false;
     }
     
+    std::vector<std::string> messages;
+    messages.reserve(pizzaIndexes.size());
+    for (size_t index : pizzaIndexes) {
+        messages.push_back(IPCMessage::encode(PizzaMessage, pizzas[index]));
+    }
+    
     try {
-        if (kitchenProcess->ipc->send("PIZZA:" + pizza.pack())) {
-            kitchenProcess->kitchen->incrementPendingPizzas();
+        if (kitchenProcess->ipc->sendBatch(messages)) {
             kitchenProcess->kitchen->updateLastActivity();
+            if (kitchenProcess->state == SpawningKitchen) {
+                for (size_t index : pizzaIndexes) {
+                    kitchenProcess->unconfirmedPizzas.push_back(pizzas[index]);
+                }
+            }
             return true;
+        } else if (kitchenProcess->ipc->isChannelFull()) {
+            LOG_WARNING("Kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                        " channel full, rerouting pizzas");
         } else {
-            LOG_ERROR("Failed to send pizza via IPC to kitchen " + 
+            LOG_ERROR("Failed to send pizzas via IPC to kitchen " + 
                      std::to_string(kitchenProcess->kitchen->getId()));
         }
     } catch (const std::exception& e) {
-        LOG_ERROR("Failed to distribute pizza: " + std::string(e.what()));
+        LOG_ERROR("Failed to distribute pizzas: " + std::string(e.what()));
     }
     
     return false;
 }
 
 void KitchenManager::createNewKitchen() {
+    spawnKitchen(false);
+}
+
+int KitchenManager::getEventFd() const {
+    return _epollFd;
+}
+
+void KitchenManager::maintainWarmPool() {
+    _warmPoolMaintenanceDue = false;
+    cleanupDeadKitchens();
+    
+    int idleLimit = std::min(_warmKitchenTarget, IDLE_WARM_KITCHENS);
+    auto idleFor = std::chrono::steady_clock::now() - _lastDispatchAt;
+    bool idle = idleFor >= std::chrono::milliseconds(WARM_POOL_IDLE_MS);
+    int limit = idle ? idleLimit : _warmKitchenTarget;
+    
+    retireSurplusWarmKitchens(limit);
+    for (int warmCount = countWarmKitchens(); warmCount < limit; ++warmCount) {
+        spawnKitchen(true);
+    }
+    
+    if (!idle && countWarmKitchens() > idleLimit) {
+        auto remaining = std::chrono::milliseconds(WARM_POOL_IDLE_MS) -
+                         std::chrono::duration_cast<std::chrono::milliseconds>(idleFor);
+        scheduleWarmPoolMaintenance(std::max(static_cast<int>(remaining.count()), WARM_POOL_REFILL_DELAY_MS));
+    }
+}
+
+void KitchenManager::retireSurplusWarmKitchens(int limit) {
+    int warmCount = countWarmKitchens();
+    
+    for (auto it = _kitchens.rbegin(); it != _kitchens.rend() && warmCount > limit; ++it) {
+        if (!(*it)->warm) {
+            continue;
+        }
+        
+        LOG_INFO("Retiring idle warm kitchen " + std::to_string((*it)->kitchen->getId()));
+        drainKitchen(it->get());
+        --warmCount;
+    }
+    
+    terminateDrainedKitchens();
+}
+
+void KitchenManager::scheduleWarmPoolMaintenance(int delayMs) {
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec = delayMs / 1000;
+    spec.it_value.tv_nsec = (delayMs % 1000) * 1000000L;
+    
+    if (timerfd_settime(_warmPoolTimerFd, 0, &spec, nullptr) == -1) {
+        LOG_ERROR("Failed to arm warm pool timer");
+    }
+}
+
+KitchenProcess* KitchenManager::promoteWarmKitchen() {
+    KitchenProcess* candidate = nullptr;
+    
+    for (const auto& kitchenProcess : _kitchens) {
+        if (!kitchenProcess->warm || !isKitchenReachable(kitchenProcess.get())) {
+            continue;
+        }
+        
+        if (!candidate || kitchenProcess->state == ReadyKitchen) {
+            candidate = kitchenProcess.get();
+        }
+        if (kitchenProcess->state == ReadyKitchen) {
+            break;
+        }
+    }
+    
+    if (candidate) {
+        candidate->warm = false;
+        candidate->kitchen->updateLastActivity();
+        refreshKitchenLoad(candidate);
+    }
+    return candidate;
+}
+
+int KitchenManager::countWarmKitchens() const {
+    int warmCount = 0;
+    for (const auto& kitchenProcess : _kitchens) {
+        if (kitchenProcess->warm) {
+            ++warmCount;
+        }
+    }
+    return warmCount;
+}
+
+void KitchenManager::spawnKitchen(bool warm) {
     auto kitchen = std::make_unique<Kitchen>(_nextKitchenId++, _numCooksPerKitchen, 
-                                           _multiplier, _restockTime);
-    auto ipc = std::make_unique<PipeIPC>();
+                                           _multiplier, _restockTime, _scheduling,
+                                           _statusWindowMs);
+    auto ipc = IPCFactory::createIPC(_transport);
     
-    if (!ipc->createPipes()) {
-        throw KitchenException("Failed to create IPC pipes for kitchen");
+    if (!ipc->create()) {
+        throw KitchenException("Failed to create " + IPCFactory::transportToString(_transport) +
+                               " IPC channel for kitchen");
     }
     
     int kitchenId = kitchen->getId();
     forkKitchenProcess(std::move(kitchen), std::move(ipc), kitchenId);
-    
-    Timer::sleep(100);
+    _kitchens.back()->warm = warm;
+    refreshKitchenLoad(_kitchens.back().get());
 }
 
 pid_t KitchenManager::forkKitchenProcess(std::unique_ptr<Kitchen> kitchen, 
-                                        std::unique_ptr<PipeIPC> ipc, int kitchenId) {
+                                        std::unique_ptr<IIPC> ipc, int kitchenId) {
     pid_t pid = fork();
     
     if (pid == -1) {
@@ -108,7 +370,13 @@ pid_t KitchenManager::forkKitchenProcess(std::unique_ptr<Kitchen> kitchen,
 }
 
 void KitchenManager::setupChildProcess(std::unique_ptr<Kitchen> kitchen, 
-                                      std::unique_ptr<PipeIPC> ipc, int kitchenId) {
+                                      std::unique_ptr<IIPC> ipc, int kitchenId) {
+    ::close(_epollFd);
+    ::close(_warmPoolTimerFd);
+    for (const auto& kitchenProcess : _kitchens) {
+        kitchenProcess->ipc->close();
+    }
+    
     Logger& logger = Logger::getInstance();
     logger.enableConsoleOutput(false);
     logger.enableFileOutput("kitchen_" + std::to_string(kitchenId) + ".log");
@@ -119,38 +387,101 @@ void KitchenManager::setupChildProcess(std::unique_ptr<Kitchen> kitchen,
 }
 
 void KitchenManager::setupParentProcess(std::unique_ptr<Kitchen> kitchen, 
-                                       std::unique_ptr<PipeIPC> ipc, pid_t pid) {
+                                       std::unique_ptr<IIPC> ipc, pid_t pid) {
     ipc->setupParent();
     kitchen->start();
     
     auto kitchenProcess = std::make_unique<KitchenProcess>(
-        std::move(kitchen), std::move(ipc), pid);
+        std::move(kitchen), std::move(ipc), pid, getKitchenCapacity());
+    kitchenProcess->status = createFallbackStatus(kitchenProcess->kitchen->getId());
+    kitchenProcess->stockEstimate = kitchenProcess->status.ingredients;
     
+    registerKitchen(kitchenProcess.get());
     _kitchens.push_back(std::move(kitchenProcess));
 }
 
+void KitchenManager::registerMessageHandlers() {
+    _dispatcher.registerHandler(CompletedMessage,
+        [this](const IPCMessage& message, KitchenProcess* kitchenProcess) {
+            return handleCompletedPizza(message, kitchenProcess);
+        });
+    _dispatcher.registerHandler(RejectedMessage,
+        [this](const IPCMessage& message, KitchenProcess* kitchenProcess) {
+            return handleRejectedPizza(message, kitchenProcess);
+        });
+    _dispatcher.registerHandler(ReadyMessage,
+        [this](const IPCMessage&, KitchenProcess* kitchenProcess) {
+            return handleReadyMessage(kitchenProcess);
+        });
+    _dispatcher.registerHandler(StatusMessage,
+        [this](const IPCMessage& message, KitchenProcess* kitchenProcess) {
+            return handleStatusMessage(message, kitchenProcess);
+        });
+    _dispatcher.registerHandler(StatusDeltaMessage,
+        [this](const IPCMessage& message, KitchenProcess* kitchenProcess) {
+            return handleStatusDeltaMessage(message, kitchenProcess);
+        });
+    _dispatcher.registerHandler(MetricsMessage,
+        [this](const IPCMessage& message, KitchenProcess* kitchenProcess) {
+            return handleMetricsMessage(message, kitchenProcess);
+        });
+}
+
+void KitchenManager::registerKitchen(KitchenProcess* kitchenProcess) {
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = kitchenProcess;
+    
+    if (epoll_ctl(_epollFd, EPOLL_CTL_ADD, kitchenProcess->ipc->getReadFd(), &event) == -1) {
+        LOG_ERROR("Failed to watch kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                  " for completed pizzas");
+    }
+}
+
+void KitchenManager::unregisterKitchen(KitchenProcess* kitchenProcess) {
+    _pendingRequests.cancelOwner(kitchenProcess->kitchen->getId());
+    for (auto& loadIndex : _loadIndexes) {
+        loadIndex.erase(kitchenProcess);
+    }
+    
+    if (kitchenProcess->ipc && kitchenProcess->ipc->getReadFd() != -1) {
+        epoll_ctl(_epollFd, EPOLL_CTL_DEL, kitchenProcess->ipc->getReadFd(), nullptr);
+    }
+}
+
 void KitchenManager::closeInactiveKitchens() {
     ScopedLock lock(_kitchensMutex);
     
-    for (auto it = _kitchens.begin(); it != _kitchens.end();) {
-        if (shouldCloseKitchen(*it)) {
-            terminateKitchenProcess(*it);
-            it = _kitchens.erase(it);
-        } else {
-            ++it;
+    cleanupDeadKitchens();
+    
+    for (const auto& kitchenProcess : _kitchens) {
+        if (!kitchenProcess->warm && kitchenProcess->state == ReadyKitchen && kitchenProcess->kitchen->shouldClose()) {
+            LOG_INFO("Draining inactive kitchen " + std::to_string(kitchenProcess->kitchen->getId()));
+            drainKitchen(kitchenProcess.get());
         }
     }
+    
+    terminateDrainedKitchens();
 }
 
-bool KitchenManager::shouldCloseKitchen(const std::unique_ptr<KitchenProcess>& kitchenProcess) {
-    int status;
-    pid_t result = waitpid(kitchenProcess->pid, &status, WNOHANG);
-    
-    if (result == kitchenProcess->pid) {
-        return true;
+void KitchenManager::drainKitchen(KitchenProcess* kitchenProcess) {
+    kitchenProcess->state = DrainingKitchen;
+    kitchenProcess->warm = false;
+    refreshKitchenLoad(kitchenProcess);
+}
+
+void KitchenManager::terminateDrainedKitchens() {
+    for (auto it = _kitchens.begin(); it != _kitchens.end();) {
+        if ((*it)->state != DrainingKitchen || (*it)->credits < getKitchenCapacity()) {
+            ++it;
+            continue;
+        }
+        
+        terminateKitchenProcess(*it);
+        (*it)->state = DeadKitchen;
+        unregisterKitchen(it->get());
+        it = _kitchens.erase(it);
     }
-    
-    return kitchenProcess->kitchen->shouldClose();
 }
 
 void KitchenManager::terminateKitchenProcess(const std::unique_ptr<KitchenProcess>& kitchenProcess) {
@@ -175,50 +506,103 @@ void KitchenManager::waitForKitchenTermination(pid_t pid) {
 }
 
 void KitchenManager::checkForCompletedPizzas() {
-    for (const auto& kitchenProcess : _kitchens) {
-        if (!isKitchenReady(kitchenProcess.get())) {
-            continue;
+    flushPendingOutput();
+    
+    while (waitForKitchenMessages(0) == MAX_EPOLL_EVENTS) {
+    }
+    
+    _pendingRequests.expire();
+    terminateDrainedKitchens();
+    
+    if (!_rejectedPizzas.empty()) {
+        redispatchRejectedPizzas();
+    }
+    
+    if (_warmPoolMaintenanceDue) {
+        maintainWarmPool();
+    }
+}
+
+int KitchenManager::waitForKitchenMessages(int timeoutMs) {
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    int readyCount = epoll_wait(_epollFd, events, MAX_EPOLL_EVENTS, timeoutMs);
+    
+    for (int i = 0; i < readyCount; ++i) {
+        KitchenProcess* kitchenProcess = static_cast<KitchenProcess*>(events[i].data.ptr);
+        if (!kitchenProcess) {
+            uint64_t expirations;
+            while (read(_warmPoolTimerFd, &expirations, sizeof(expirations)) > 0) {
+            }
+            _warmPoolMaintenanceDue = true;
+        } else if (isKitchenReachable(kitchenProcess)) {
+            processKitchenMessages(kitchenProcess);
         }
-        
-        processKitchenMessages(kitchenProcess.get());
     }
+    
+    return readyCount;
 }
 
-bool KitchenManager::isKitchenReady(KitchenProcess* kitchenProcess) const {
-    return kitchenProcess->active && 
+bool KitchenManager::isKitchenReachable(KitchenProcess* kitchenProcess) const {
+    return kitchenProcess->state != DeadKitchen && 
            kitchenProcess->ipc && 
            kitchenProcess->ipc->isReady();
 }
 
-void KitchenManager::processKitchenMessages(KitchenProcess* kitchenProcess) {
-    for (int i = 0; i < 20; ++i) {
-        std::string message = receiveKitchenMessage(kitchenProcess);
-        if (message.empty()) {
-            break;
+void KitchenManager::flushPendingOutput() {
+    std::vector<struct pollfd> pollFds;
+    std::vector<KitchenProcess*> owners;
+    
+    for (const auto& kitchenProcess : _kitchens) {
+        if (!isKitchenReachable(kitchenProcess.get()) || !kitchenProcess->ipc->hasPendingOutput()) {
+            continue;
+        }
+        
+        int writeFd = kitchenProcess->ipc->getWriteFd();
+        if (writeFd == -1) {
+            kitchenProcess->ipc->flush();
+            continue;
         }
         
-        handleKitchenMessage(message, kitchenProcess->kitchen->getId());
+        struct pollfd pollFd;
+        pollFd.fd = writeFd;
+        pollFd.events = POLLOUT;
+        pollFd.revents = 0;
+        pollFds.push_back(pollFd);
+        owners.push_back(kitchenProcess.get());
+    }
+    
+    if (pollFds.empty() || poll(pollFds.data(), pollFds.size(), 0) <= 0) {
+        return;
+    }
+    
+    for (size_t i = 0; i < pollFds.size(); ++i) {
+        if (pollFds[i].revents & POLLOUT) {
+            owners[i]->ipc->flush();
+        }
     }
 }
 
-std::string KitchenManager::receiveKitchenMessage(KitchenProcess* kitchenProcess) const {
-    try {
-        return kitchenProcess->ipc->receive();
-    } catch (const std::exception& e) {
-        return "";
+void KitchenManager::processKitchenMessages(KitchenProcess* kitchenProcess) {
+    while (receiveKitchenMessage(kitchenProcess, _incomingMessage)) {
+        _dispatcher.dispatch(_incomingMessage, kitchenProcess);
     }
 }
 
-void KitchenManager::handleKitchenMessage(const std::string& message, int kitchenId) {
-    if (message.substr(0, 10) == "COMPLETED:") {
-        handleCompletedPizza(message.substr(10), kitchenId);
+bool KitchenManager::receiveKitchenMessage(KitchenProcess* kitchenProcess, IPCMessage& message) const {
+    try {
+        return kitchenProcess->ipc->receive(message);
+    } catch (const std::exception& e) {
+        return false;
     }
 }
 
-void KitchenManager::handleCompletedPizza(const std::string& pizzaData, int kitchenId) {
+bool KitchenManager::handleCompletedPizza(const IPCMessage& message, KitchenProcess* kitchenProcess) {
+    int kitchenId = kitchenProcess->kitchen->getId();
+    
     try {
         SerializedPizza completedPizza;
-        completedPizza.unpack(pizzaData);
+        completedPizza.unpack(message.getPayload(), message.getPayloadSize());
+        returnCredit(kitchenProcess, completedPizza.cookingTime);
         
         std::string pizzaInfo = PizzaTypeHelper::pizzaTypeToString(completedPizza.type) + " " +
                                PizzaTypeHelper::pizzaSizeToString(completedPizza.size);
@@ -226,32 +610,136 @@ void KitchenManager::handleCompletedPizza(const std::string& pizzaData, int kitc
         std::cout << "🍕 Pizza ready: " << pizzaInfo << " (Kitchen " << kitchenId << ")" << std::endl;
         
         LOG_INFO("Pizza ready: " + pizzaInfo);
+        return true;
         
     } catch (const std::exception& e) {
+        returnCredit(kitchenProcess, 0);
         LOG_ERROR("Failed to process completed pizza from kitchen " + 
                  std::to_string(kitchenId) + ": " + e.what());
     }
+    return false;
 }
 
-void KitchenManager::displayStatus() const {
-    ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
+bool KitchenManager::handleRejectedPizza(const IPCMessage& message, KitchenProcess* kitchenProcess) {
+    try {
+        SerializedPizza pizza;
+        pizza.unpack(message.getPayload(), message.getPayloadSize());
+        adjustStockEstimate(kitchenProcess, pizza.type, 1);
+        returnCredit(kitchenProcess, pizza.cookingTime);
+        _rejectedPizzas.push_back(pizza);
+        return true;
+    } catch (const std::exception& e) {
+        returnCredit(kitchenProcess, 0);
+        LOG_ERROR("Invalid rejected pizza from kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                  ": " + e.what());
+    }
+    return false;
+}
+
+bool KitchenManager::handleReadyMessage(KitchenProcess* kitchenProcess) {
+    if (kitchenProcess->state != SpawningKitchen) {
+        return false;
+    }
+    
+    kitchenProcess->state = ReadyKitchen;
+    kitchenProcess->unconfirmedPizzas.clear();
+    refreshKitchenLoad(kitchenProcess);
     
-    const_cast<KitchenManager*>(this)->checkForCompletedPizzas();
+    auto startup = std::chrono::steady_clock::now() - kitchenProcess->spawnedAt;
+    LOG_INFO("Kitchen " + std::to_string(kitchenProcess->kitchen->getId()) + " ready after " +
+             std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(startup).count()) + "us");
+    return true;
+}
+
+void KitchenManager::consumeCredit(KitchenProcess* kitchenProcess, const SerializedPizza& pizza) {
+    --kitchenProcess->credits;
+    kitchenProcess->inFlightWork += pizza.cookingTime;
+    adjustStockEstimate(kitchenProcess, pizza.type, -1);
+    refreshKitchenLoad(kitchenProcess);
+}
+
+void KitchenManager::returnCredit(KitchenProcess* kitchenProcess, int cookingTime) {
+    if (kitchenProcess->credits < getKitchenCapacity()) {
+        ++kitchenProcess->credits;
+        kitchenProcess->inFlightWork -= cookingTime;
+    }
+    
+    if (kitchenProcess->credits == getKitchenCapacity() || kitchenProcess->inFlightWork < 0) {
+        kitchenProcess->inFlightWork = 0;
+    }
+    refreshKitchenLoad(kitchenProcess);
+}
+
+int KitchenManager::getKitchenCapacity() const {
+    return 2 * _numCooksPerKitchen;
+}
+
+bool KitchenManager::handleStatusMessage(const IPCMessage& message, KitchenProcess* kitchenProcess) {
+    try {
+        KitchenStatus status;
+        status.unpack(message.getPayload(), message.getPayloadSize());
+        kitchenProcess->status = status;
+        kitchenProcess->stockEstimate = status.ingredients;
+        refreshKitchenLoad(kitchenProcess);
+    } catch (const std::exception& e) {
+        LOG_ERROR("Invalid status from kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                  ": " + e.what());
+    }
+    
+    if (message.getCorrelationId() == 0) {
+        return true;
+    }
+    return _pendingRequests.complete(message);
+}
+
+bool KitchenManager::handleStatusDeltaMessage(const IPCMessage& message, KitchenProcess* kitchenProcess) {
+    try {
+        StatusDelta delta;
+        delta.unpack(message.getPayload(), message.getPayloadSize());
+        std::array<int, INGREDIENT_COUNT> previousIngredients = kitchenProcess->status.ingredients;
+        delta.applyTo(kitchenProcess->status);
+        if (kitchenProcess->status.ingredients != previousIngredients) {
+            kitchenProcess->stockEstimate = kitchenProcess->status.ingredients;
+        }
+        refreshKitchenLoad(kitchenProcess);
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("Invalid status delta from kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                  ": " + e.what());
+    }
+    return false;
+}
+
+bool KitchenManager::handleMetricsMessage(const IPCMessage& message, KitchenProcess* kitchenProcess) {
+    try {
+        kitchenProcess->metrics.unpack(message.getPayload(), message.getPayloadSize());
+        kitchenProcess->hasMetrics = true;
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("Invalid metrics from kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                  ": " + e.what());
+    }
+    return false;
+}
+
+void KitchenManager::displayStatus(const std::vector<KitchenStatus>& statuses) const {
+    ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
     
     displayStatusHeader();
     
-    if (_kitchens.empty()) {
+    if (_kitchens.size() == static_cast<size_t>(countWarmKitchens())) {
         displayNoKitchensMessage();
         return;
     }
     
-    displayAllKitchens();
+    displayAllKitchens(statuses);
     displayStatusFooter();
 }
 
 void KitchenManager::displayStatusHeader() const {
     std::cout << "\n=== KITCHEN STATUS ===" << std::endl;
-    std::cout << "Total kitchens: " << _kitchens.size() << std::endl;
+    std::cout << "Total kitchens: " << _kitchens.size() - countWarmKitchens() << std::endl;
+    std::cout << "Warm kitchens: " << countWarmKitchens() << "/" << _warmKitchenTarget << std::endl;
 }
 
 void KitchenManager::displayNoKitchensMessage() const {
@@ -259,65 +747,163 @@ void KitchenManager::displayNoKitchensMessage() const {
     std::cout << "=====================" << std::endl;
 }
 
-void KitchenManager::displayAllKitchens() const {
-    for (const auto& kitchenProcess : _kitchens) {
-        if (kitchenProcess->active) {
-            displaySingleKitchen(kitchenProcess.get());
-        }
+void KitchenManager::displayAllKitchens(const std::vector<KitchenStatus>& statuses) const {
+    for (const auto& status : statuses) {
+        KitchenProcess* kitchenProcess = findKitchen(status.kitchenId);
+        displayKitchenInfo(status, kitchenProcess);
+        displayKitchenMetrics(kitchenProcess);
     }
 }
 
-void KitchenManager::displaySingleKitchen(KitchenProcess* kitchenProcess) const {
-    KitchenStatus status = getKitchenStatus(kitchenProcess);
-    displayKitchenInfo(status, kitchenProcess->pid);
+bool KitchenManager::requestKitchenStatus(int kitchenId, StatusCallback callback) {
+    ScopedLock lock(_kitchensMutex);
+    
+    KitchenProcess* kitchenProcess = findKitchen(kitchenId);
+    if (!kitchenProcess || !isKitchenReachable(kitchenProcess)) {
+        return false;
+    }
+    
+    return sendStatusRequest(kitchenProcess, std::move(callback)) != 0;
 }
 
-KitchenStatus KitchenManager::getKitchenStatus(KitchenProcess* kitchenProcess) const {
-    KitchenStatus status;
-    bool gotRealStatus = false;
+std::future<KitchenStatus> KitchenManager::requestKitchenStatus(int kitchenId) {
+    auto promise = std::make_shared<std::promise<KitchenStatus>>();
+    std::future<KitchenStatus> reply = promise->get_future();
+    uint32_t correlationId = 0;
     
-    if (isKitchenReady(kitchenProcess)) {
-        gotRealStatus = requestKitchenStatus(kitchenProcess, status);
+    {
+        ScopedLock lock(_kitchensMutex);
+        
+        KitchenProcess* kitchenProcess = findKitchen(kitchenId);
+        if (!kitchenProcess || !isKitchenReachable(kitchenProcess)) {
+            promise->set_exception(std::make_exception_ptr(
+                KitchenException("Cannot request status from kitchen " + std::to_string(kitchenId))));
+            return reply;
+        }
+        
+        correlationId = sendStatusRequest(kitchenProcess, [promise, kitchenId](bool received, const KitchenStatus& status) {
+            if (received) {
+                promise->set_value(status);
+            } else {
+                promise->set_exception(std::make_exception_ptr(
+                    KitchenException("No status from kitchen " + std::to_string(kitchenId))));
+            }
+        });
     }
     
-    if (!gotRealStatus) {
-        status = createFallbackStatus(kitchenProcess->kitchen->getId());
+    if (correlationId == 0) {
+        return reply;
     }
     
-    return status;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(STATUS_REQUEST_TIMEOUT_MS);
+    return std::async(std::launch::deferred, [this, correlationId, deadline, reply = std::move(reply)]() mutable {
+        {
+            ScopedLock lock(_kitchensMutex);
+            waitForStatusReplies({correlationId}, deadline);
+        }
+        return reply.get();
+    });
 }
 
-bool KitchenManager::requestKitchenStatus(KitchenProcess* kitchenProcess, KitchenStatus& status) const {
-    try {
-        if (!kitchenProcess->ipc->send("STATUS_REQUEST")) {
-            return false;
+std::vector<KitchenStatus> KitchenManager::collectKitchenStatuses() {
+    ScopedLock lock(_kitchensMutex);
+    
+    checkForCompletedPizzas();
+    
+    std::vector<uint32_t> correlationIds;
+    for (const auto& kitchenProcess : _kitchens) {
+        if (kitchenProcess->warm || !isKitchenReachable(kitchenProcess.get())) {
+            continue;
         }
         
-        return waitForStatusResponse(kitchenProcess, status);
-        
-    } catch (const std::exception& e) {
-        LOG_ERROR("Failed to get status from kitchen " + 
-                 std::to_string(kitchenProcess->kitchen->getId()) + ": " + e.what());
-        return false;
+        uint32_t correlationId = sendStatusRequest(kitchenProcess.get(), [](bool, const KitchenStatus&) {});
+        if (correlationId != 0) {
+            correlationIds.push_back(correlationId);
+        }
+    }
+    
+    waitForStatusReplies(correlationIds,
+                         std::chrono::steady_clock::now() + std::chrono::milliseconds(STATUS_REQUEST_TIMEOUT_MS));
+    return snapshotKitchenStatuses();
+}
+
+KitchenProcess* KitchenManager::findKitchen(int kitchenId) const {
+    for (const auto& kitchenProcess : _kitchens) {
+        if (kitchenProcess->kitchen->getId() == kitchenId) {
+            return kitchenProcess.get();
+        }
     }
+    return nullptr;
 }
 
-bool KitchenManager::waitForStatusResponse(KitchenProcess* kitchenProcess, KitchenStatus& status) const {
-    for (int i = 0; i < 50; ++i) {
-        std::string response = receiveKitchenMessage(kitchenProcess);
-        if (!response.empty()) {
-            if (response.substr(0, 7) == "STATUS:") {
-                status.unpack(response.substr(7));
-                return true;
-            } else if (response.substr(0, 10) == "COMPLETED:") {
-                const_cast<KitchenManager*>(this)->handleCompletedPizza(
-                    response.substr(10), kitchenProcess->kitchen->getId());
+uint32_t KitchenManager::sendStatusRequest(KitchenProcess* kitchenProcess, StatusCallback callback) {
+    int kitchenId = kitchenProcess->kitchen->getId();
+    
+    uint32_t correlationId = _pendingRequests.add(kitchenId, STATUS_REQUEST_TIMEOUT_MS,
+        [callback, kitchenId](const IPCMessage* response) {
+            KitchenStatus status;
+            status.kitchenId = kitchenId;
+            
+            if (!response) {
+                callback(false, status);
+                return;
             }
+            
+            try {
+                status.unpack(response->getPayload(), response->getPayloadSize());
+                callback(true, status);
+            } catch (const std::exception& e) {
+                LOG_ERROR("Invalid status from kitchen " + std::to_string(kitchenId) + ": " + e.what());
+                callback(false, status);
+            }
+        });
+    
+    try {
+        if (kitchenProcess->ipc->send(IPCMessage::encode(StatusRequestMessage, correlationId))) {
+            return correlationId;
         }
-        Timer::sleep(10);
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to request status from kitchen " + std::to_string(kitchenId) + ": " + e.what());
     }
     
-    return false;
+    _pendingRequests.cancel(correlationId);
+    return 0;
+}
+
+void KitchenManager::waitForStatusReplies(const std::vector<uint32_t>& correlationIds,
+                                          std::chrono::steady_clock::time_point deadline) {
+    auto outstanding = [this, &correlationIds]() {
+        return std::any_of(correlationIds.begin(), correlationIds.end(), [this](uint32_t correlationId) {
+            return _pendingRequests.contains(correlationId);
+        });
+    };
+    
+    while (outstanding()) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (remaining.count() < 0) {
+            break;
+        }
+        
+        flushPendingOutput();
+        waitForKitchenMessages(static_cast<int>(remaining.count()) + 1);
+    }
+    
+    for (uint32_t correlationId : correlationIds) {
+        _pendingRequests.cancel(correlationId);
+    }
+}
+
+std::vector<KitchenStatus> KitchenManager::snapshotKitchenStatuses() const {
+    std::vector<KitchenStatus> statuses;
+    
+    for (const auto& kitchenProcess : _kitchens) {
+        if (kitchenProcess->state != DeadKitchen && !kitchenProcess->warm) {
+            statuses.push_back(kitchenProcess->status);
+        }
+    }
+    
+    return statuses;
 }
 
 KitchenStatus KitchenManager::createFallbackStatus(int kitchenId) const {
@@ -326,19 +912,48 @@ KitchenStatus KitchenManager::createFallbackStatus(int kitchenId) const {
     status.activeCooks = 0;
     status.totalCooks = _numCooksPerKitchen;
     status.pizzasInQueue = 0;
-    status.maxCapacity = 2 * _numCooksPerKitchen;
-    status.ingredients = {5, 5, 5, 5, 5, 5, 5, 5, 5};
+    status.maxCapacity = getKitchenCapacity();
+    status.blockedPizzas = 0;
+    status.schedulingPolicy = _scheduling;
+    status.meanQueueWaitUs = 0;
+    status.p99QueueWaitUs = 0;
+    status.ingredients.fill(5);
     return status;
 }
 
-void KitchenManager::displayKitchenInfo(const KitchenStatus& status, pid_t pid) const {
-    std::cout << "\nKitchen " << status.kitchenId << " (PID: " << pid << "):" << std::endl;
+void KitchenManager::displayKitchenInfo(const KitchenStatus& status, const KitchenProcess* kitchenProcess) const {
+    std::cout << "\nKitchen " << status.kitchenId << " (PID: " << (kitchenProcess ? kitchenProcess->pid : -1)
+              << ", " << kitchenStateToString(kitchenProcess ? kitchenProcess->state : DeadKitchen) << "):" << std::endl;
     std::cout << "  Active cooks: " << status.activeCooks << "/" << status.totalCooks << std::endl;
     std::cout << "  Pizzas in queue: " << status.pizzasInQueue << "/" << status.maxCapacity << std::endl;
+    std::cout << "  Waiting for ingredients: " << status.blockedPizzas << std::endl;
+    std::cout << "  Scheduling: "
+              << SchedulingPolicyFactory::policyToString(static_cast<SchedulingPolicyKind>(status.schedulingPolicy))
+              << " (queue wait mean " << status.meanQueueWaitUs / 1000.0
+              << "ms, p99 " << status.p99QueueWaitUs / 1000.0 << "ms)" << std::endl;
     displayIngredients(status.ingredients);
 }
 
-void KitchenManager::displayIngredients(const std::vector<int>& ingredients) const {
+void KitchenManager::displayKitchenMetrics(const KitchenProcess* kitchenProcess) const {
+    if (!kitchenProcess || !kitchenProcess->hasMetrics) {
+        std::cout << "  Metrics: none reported yet" << std::endl;
+        return;
+    }
+    
+    const KitchenMetricsSnapshot& metrics = kitchenProcess->metrics;
+    std::cout << "  Utilization: " << metrics.utilization / 10.0 << "% (last interval "
+              << metrics.recentUtilization / 10.0 << "%, uptime " << metrics.uptimeMs / 1000.0 << "s)" << std::endl;
+    std::cout << "  Pizzas completed: " << metrics.pizzasCompleted
+              << ", ingredient starvations: " << metrics.starvationEvents << std::endl;
+    std::cout << "  Queue wait: mean " << metrics.queueWaitMeanUs / 1000.0 << "ms, p50 "
+              << metrics.queueWaitP50Us / 1000.0 << "ms, p99 " << metrics.queueWaitP99Us / 1000.0
+              << "ms, max " << metrics.queueWaitMaxUs / 1000.0 << "ms" << std::endl;
+    std::cout << "  Cook time: mean " << metrics.cookTimeMeanUs / 1000.0 << "ms, p50 "
+              << metrics.cookTimeP50Us / 1000.0 << "ms, p99 " << metrics.cookTimeP99Us / 1000.0
+              << "ms, max " << metrics.cookTimeMaxUs / 1000.0 << "ms" << std::endl;
+}
+
+void KitchenManager::displayIngredients(const std::array<int, INGREDIENT_COUNT>& ingredients) const {
     std::cout << "  Ingredients: ";
     
     const std::vector<std::string> ingredientNames = {
@@ -358,63 +973,92 @@ void KitchenManager::displayStatusFooter() const {
 
 std::vector<KitchenStatus> KitchenManager::getAllKitchenStatuses() const {
     ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
+    return snapshotKitchenStatuses();
+}
+
+std::vector<KitchenMetricsSnapshot> KitchenManager::getAllKitchenMetrics() const {
+    ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
     
-    std::vector<KitchenStatus> statuses;
-    
+    std::vector<KitchenMetricsSnapshot> metrics;
     for (const auto& kitchenProcess : _kitchens) {
-        if (kitchenProcess->active) {
-            statuses.push_back(kitchenProcess->kitchen->getStatus());
+        if (kitchenProcess->state != DeadKitchen && !kitchenProcess->warm && kitchenProcess->hasMetrics) {
+            metrics.push_back(kitchenProcess->metrics);
         }
     }
     
-    return statuses;
+    return metrics;
 }
 
 int KitchenManager::getKitchenCount() const {
     ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
-    return _kitchens.size();
+    return _kitchens.size() - countWarmKitchens();
+}
+
+int KitchenManager::getWarmKitchenCount() const {
+    ScopedLock lock(const_cast<Mutex&>(_kitchensMutex));
+    return countWarmKitchens();
 }
 
 void KitchenManager::cleanup() {
     ScopedLock lock(_kitchensMutex);
     
     for (auto& kitchenProcess : _kitchens) {
-        if (kitchenProcess->active) {
+        if (kitchenProcess->state != DeadKitchen) {
             terminateKitchenProcess(kitchenProcess);
+            kitchenProcess->state = DeadKitchen;
         }
+        unregisterKitchen(kitchenProcess.get());
     }
     
     _kitchens.clear();
 }
 
-int KitchenManager::findBestKitchen() const {
-    if (_kitchens.empty()) {
-        return -1;
+KitchenProcess* KitchenManager::findBestKitchen(const SerializedPizza& pizza,
+                                                const std::vector<KitchenProcess*>& excluded) const {
+    KitchenProcess* best = nullptr;
+    _loadIndexes[recipeIndex(pizza.type)].findMin([&excluded](KitchenProcess* kitchenProcess) {
+        return std::find(excluded.begin(), excluded.end(), kitchenProcess) == excluded.end();
+    }, best);
+    return best;
+}
+
+void KitchenManager::refreshKitchenLoad(KitchenProcess* kitchenProcess) {
+    bool routable = kitchenProcess->state == SpawningKitchen || kitchenProcess->state == ReadyKitchen;
+    if (!routable || kitchenProcess->warm || kitchenProcess->credits <= 0) {
+        for (auto& loadIndex : _loadIndexes) {
+            loadIndex.erase(kitchenProcess);
+        }
+        return;
     }
     
-    int bestIndex = -1;
-    int minLoad = INT_MAX;
+    bool degraded = kitchenProcess->status.blockedPizzas > 0 || kitchenProcess->state == SpawningKitchen;
+    for (size_t i = 0; i < _loadIndexes.size(); ++i) {
+        StockReadiness readiness = getStockReadiness(kitchenProcess, PIZZA_RECIPES[i].ingredients);
+        _loadIndexes[i].set(kitchenProcess, {readiness, degraded, kitchenProcess->inFlightWork,
+                                             kitchenProcess->kitchen->getId()});
+    }
+}
+
+StockReadiness KitchenManager::getStockReadiness(const KitchenProcess* kitchenProcess, IngredientMask recipe) const {
+    StockReadiness readiness = CookableNow;
     
-    for (size_t i = 0; i < _kitchens.size(); ++i) {
-        const auto& kitchenProcess = _kitchens[i];
-        
-        if (!kitchenProcess->active || !kitchenProcess->kitchen->canAcceptPizza()) {
-            continue;
-        }
-        
-        int load = kitchenProcess->kitchen->getPendingPizzaCount();
-        
-        if (load < minLoad) {
-            minLoad = load;
-            bestIndex = static_cast<int>(i);
+    for (IngredientMask remaining = recipe; remaining != 0; remaining &= remaining - 1) {
+        int estimate = kitchenProcess->stockEstimate[__builtin_ctz(remaining)];
+        if (estimate + INGREDIENTS_PER_RESTOCK <= 0) {
+            return NotCookable;
         }
-        
-        if (load == 0) {
-            break;
+        if (estimate <= 0) {
+            readiness = CookableAfterRestock;
         }
     }
-    
-    return bestIndex;
+    return readiness;
+}
+
+void KitchenManager::adjustStockEstimate(KitchenProcess* kitchenProcess, PizzaType type, int amount) {
+    for (IngredientMask remaining = PizzaTypeHelper::getIngredientMask(type); remaining != 0;
+         remaining &= remaining - 1) {
+        kitchenProcess->stockEstimate[__builtin_ctz(remaining)] += amount;
+    }
 }
 
 void KitchenManager::cleanupDeadKitchens() {
@@ -424,10 +1068,35 @@ void KitchenManager::cleanupDeadKitchens() {
         int status;
         pid_t result = waitpid(kitchenProcess->pid, &status, WNOHANG);
         
+        if (result != kitchenProcess->pid && kitchenProcess->state == SpawningKitchen &&
+            std::chrono::steady_clock::now() - kitchenProcess->spawnedAt >
+                std::chrono::milliseconds(KITCHEN_SPAWN_TIMEOUT_MS)) {
+            LOG_ERROR("Kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                      " did not report ready, terminating it");
+            terminateKitchenProcess(kitchenProcess);
+            result = kitchenProcess->pid;
+        }
+        
         if (result == kitchenProcess->pid) {
+            requeueUnconfirmedPizzas(kitchenProcess.get());
+            kitchenProcess->state = DeadKitchen;
+            unregisterKitchen(kitchenProcess.get());
             it = _kitchens.erase(it);
         } else {
             ++it;
         }
     }
+}
+
+void KitchenManager::requeueUnconfirmedPizzas(KitchenProcess* kitchenProcess) {
+    if (kitchenProcess->unconfirmedPizzas.empty()) {
+        return;
+    }
+    
+    LOG_WARNING("Requeueing " + std::to_string(kitchenProcess->unconfirmedPizzas.size()) +
+                " pizza(s) sent to kitchen " + std::to_string(kitchenProcess->kitchen->getId()) +
+                " before it was ready");
+    _rejectedPizzas.insert(_rejectedPizzas.end(), kitchenProcess->unconfirmedPizzas.begin(),
+                           kitchenProcess->unconfirmedPizzas.end());
+    kitchenProcess->unconfirmedPizzas.clear();
 }
\ No newline at end of file
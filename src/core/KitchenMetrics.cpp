@@ -0,0 +1,112 @@
+#include "core/KitchenMetrics.hpp"
+#include <algorithm>
+
+namespace {
+    int toInt32(uint64_t value) {
+        return static_cast<int>(std::min<uint64_t>(value, INT32_MAX));
+    }
+    
+    int utilizationPermille(uint64_t busyMicros, uint64_t elapsedMicros, int numCooks) {
+        if (elapsedMicros == 0 || numCooks <= 0) {
+            return 0;
+        }
+        return toInt32(std::min<uint64_t>(1000, busyMicros * 1000 / (elapsedMicros * numCooks)));
+    }
+}
+
+KitchenMetrics::Shard::Shard() : pizzasCompleted(0), starvationEvents(0) {}
+
+KitchenMetrics::KitchenMetrics(int numCooks)
+    : _numCooks(numCooks), _startedAt(Clock::now()), _lastReportAt(_startedAt), _lastReportBusyMicros(0),
+      _cooking(0), _busySince(_startedAt), _busyMicros(0) {}
+
+void KitchenMetrics::start() {
+    _startedAt = Clock::now();
+    _lastReportAt = _startedAt;
+    _lastReportBusyMicros = 0;
+    
+    ScopedLock lock(_busyMutex);
+    _busySince = _startedAt;
+    _busyMicros = 0;
+}
+
+void KitchenMetrics::recordQueueWait(MetricsShard shard, uint64_t micros) {
+    ScopedLock lock(_shards[shard].mutex);
+    _shards[shard].queueWait.record(micros);
+}
+
+void KitchenMetrics::recordCookStart() {
+    accrueBusyTime(Clock::now(), 1);
+}
+
+void KitchenMetrics::recordCook(MetricsShard shard, uint64_t micros) {
+    accrueBusyTime(Clock::now(), -1);
+    
+    ScopedLock lock(_shards[shard].mutex);
+    _shards[shard].cookTime.record(micros);
+    ++_shards[shard].pizzasCompleted;
+}
+
+void KitchenMetrics::recordStarvation(MetricsShard shard) {
+    ScopedLock lock(_shards[shard].mutex);
+    ++_shards[shard].starvationEvents;
+}
+
+void KitchenMetrics::fillQueueWait(MetricsShard shard, KitchenStatus& status) const {
+    ScopedLock lock(const_cast<Mutex&>(_shards[shard].mutex));
+    status.meanQueueWaitUs = toInt32(static_cast<uint64_t>(_shards[shard].queueWait.getMean()));
+    status.p99QueueWaitUs = toInt32(_shards[shard].queueWait.getPercentile(99.0));
+}
+
+KitchenMetricsSnapshot KitchenMetrics::report(int kitchenId) {
+    LatencyHistogram queueWait;
+    LatencyHistogram cookTime;
+    uint64_t pizzasCompleted = 0;
+    uint64_t starvationEvents = 0;
+    
+    for (auto& shard : _shards) {
+        ScopedLock lock(shard.mutex);
+        queueWait.merge(shard.queueWait);
+        cookTime.merge(shard.cookTime);
+        pizzasCompleted += shard.pizzasCompleted;
+        starvationEvents += shard.starvationEvents;
+    }
+    
+    Clock::time_point now = Clock::now();
+    uint64_t busyMicros = accrueBusyTime(now, 0);
+    uint64_t uptimeMicros = std::chrono::duration_cast<std::chrono::microseconds>(now - _startedAt).count();
+    uint64_t intervalMicros = std::chrono::duration_cast<std::chrono::microseconds>(now - _lastReportAt).count();
+    
+    KitchenMetricsSnapshot snapshot;
+    snapshot.kitchenId = kitchenId;
+    snapshot.uptimeMs = toInt32(uptimeMicros / 1000);
+    snapshot.utilization = utilizationPermille(busyMicros, uptimeMicros, _numCooks);
+    snapshot.recentUtilization = utilizationPermille(busyMicros - _lastReportBusyMicros, intervalMicros, _numCooks);
+    snapshot.pizzasCompleted = toInt32(pizzasCompleted);
+    snapshot.starvationEvents = toInt32(starvationEvents);
+    snapshot.queueWaitMeanUs = toInt32(static_cast<uint64_t>(queueWait.getMean()));
+    snapshot.queueWaitP50Us = toInt32(queueWait.getPercentile(50.0));
+    snapshot.queueWaitP99Us = toInt32(queueWait.getPercentile(99.0));
+    snapshot.queueWaitMaxUs = toInt32(queueWait.getMax());
+    snapshot.cookTimeMeanUs = toInt32(static_cast<uint64_t>(cookTime.getMean()));
+    snapshot.cookTimeP50Us = toInt32(cookTime.getPercentile(50.0));
+    snapshot.cookTimeP99Us = toInt32(cookTime.getPercentile(99.0));
+    snapshot.cookTimeMaxUs = toInt32(cookTime.getMax());
+    
+    _lastReportAt = now;
+    _lastReportBusyMicros = busyMicros;
+    return snapshot;
+}
+
+uint64_t KitchenMetrics::accrueBusyTime(Clock::time_point now, int cookingChange) {
+    ScopedLock lock(_busyMutex);
+    
+    if (now > _busySince) {
+        uint64_t elapsedMicros = std::chrono::duration_cast<std::chrono::microseconds>(now - _busySince).count();
+        _busyMicros += elapsedMicros * _cooking;
+        _busySince = now;
+    }
+    
+    _cooking = std::max(0, _cooking + cookingChange);
+    return _busyMicros;
+}
@@ -0,0 +1,150 @@
+#include "core/OvenScheduler.hpp"
+#include "utils/Exception.hpp"
+#include "utils/Logger.hpp"
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
+bool OvenScheduler::Entry::operator>(const Entry& other) const {
+    if (deadline != other.deadline) {
+        return deadline > other.deadline;
+    }
+    return sequence > other.sequence;
+}
+
+OvenScheduler::OvenScheduler() : _nextSequence(0), _timerFd(-1), _wakeFd(-1), _running(false) {
+    _timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    _wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    
+    if (_timerFd == -1 || _wakeFd == -1) {
+        if (_timerFd != -1) {
+            ::close(_timerFd);
+        }
+        if (_wakeFd != -1) {
+            ::close(_wakeFd);
+        }
+        throw ThreadException("Failed to create oven timer");
+    }
+}
+
+OvenScheduler::~OvenScheduler() {
+    stop();
+    ::close(_timerFd);
+    ::close(_wakeFd);
+}
+
+void OvenScheduler::start() {
+    if (_running) {
+        return;
+    }
+    
+    _running = true;
+    _thread = std::thread(&OvenScheduler::timerLoop, this);
+}
+
+void OvenScheduler::stop() {
+    if (!_running) {
+        return;
+    }
+    
+    _running = false;
+    uint64_t value = 1;
+    if (write(_wakeFd, &value, sizeof(value)) == -1) {
+        LOG_ERROR("Failed to wake oven timer thread");
+    }
+    
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void OvenScheduler::schedule(int delayMs, Callback callback) {
+    Entry entry;
+    entry.deadline = Clock::now() + std::chrono::milliseconds(delayMs);
+    entry.callback = std::move(callback);
+    
+    ScopedLock lock(_mutex);
+    entry.sequence = _nextSequence++;
+    
+    bool earliest = _entries.empty() || entry.deadline < _entries.top().deadline;
+    _entries.push(std::move(entry));
+    
+    if (earliest) {
+        armTimer(_entries.top().deadline);
+    }
+}
+
+size_t OvenScheduler::getPendingCount() const {
+    ScopedLock lock(const_cast<Mutex&>(_mutex));
+    return _entries.size();
+}
+
+void OvenScheduler::timerLoop() {
+    struct pollfd fds[2];
+    fds[0].fd = _timerFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = _wakeFd;
+    fds[1].events = POLLIN;
+    
+    while (_running) {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+        
+        if (poll(fds, 2, -1) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+        
+        if (fds[0].revents & POLLIN) {
+            uint64_t expirations;
+            if (read(_timerFd, &expirations, sizeof(expirations)) == -1 && errno != EAGAIN) {
+                break;
+            }
+            fireExpired();
+        }
+    }
+}
+
+void OvenScheduler::fireExpired() {
+    std::vector<Callback> due;
+    
+    {
+        ScopedLock lock(_mutex);
+        Clock::time_point now = Clock::now();
+        
+        while (!_entries.empty() && _entries.top().deadline <= now) {
+            due.push_back(std::move(const_cast<Entry&>(_entries.top()).callback));
+            _entries.pop();
+        }
+        
+        if (!_entries.empty()) {
+            armTimer(_entries.top().deadline);
+        }
+    }
+    
+    for (auto& callback : due) {
+        callback();
+    }
+}
+
+void OvenScheduler::armTimer(Clock::time_point deadline) {
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch());
+    
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec = sinceEpoch.count() / 1000000000LL;
+    spec.it_value.tv_nsec = sinceEpoch.count() % 1000000000LL;
+    
+    if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+        spec.it_value.tv_nsec = 1;
+    }
+    
+    timerfd_settime(_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+}
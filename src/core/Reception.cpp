@@ -4,12 +4,25 @@
 #include <iostream>
 #include <sstream>
 #include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
 
-Reception::Reception(double multiplier, int numCooksPerKitchen, int restockTime)
+namespace {
+    const size_t INPUT_CHUNK_SIZE = 4096;
+}
+
+Reception::Reception(double multiplier, int numCooksPerKitchen, int restockTime,
+                     IPCTransport transport, SchedulingPolicyKind scheduling, int statusWindowMs,
+                     int warmKitchens)
     : _multiplier(multiplier), _numCooksPerKitchen(numCooksPerKitchen), 
-      _restockTime(restockTime), _running(false) {
+      _restockTime(restockTime), _transport(transport), _scheduling(scheduling),
+      _statusWindowMs(statusWindowMs), _warmKitchens(warmKitchens), _running(false),
+      _inputClosed(false) {
     
-    _kitchenManager = std::make_unique<KitchenManager>(numCooksPerKitchen, multiplier, restockTime);
+    _kitchenManager = std::make_unique<KitchenManager>(numCooksPerKitchen, multiplier,
+                                                       restockTime, transport, scheduling,
+                                                       statusWindowMs, warmKitchens);
 }
 
 Reception::~Reception() {
@@ -30,10 +43,9 @@ void Reception::run() {
     std::string input;
     
     while (_running) {
-        std::cout << "plazza> ";
-        std::getline(std::cin, input);
+        std::cout << "plazza> " << std::flush;
         
-        if (std::cin.eof()) {
+        if (!readCommand(input)) {
             break;
         }
         
@@ -66,6 +78,52 @@ void Reception::stop() {
     }
 }
 
+bool Reception::readCommand(std::string& command) {
+    while (true) {
+        size_t newline = _inputBuffer.find('\n');
+        if (newline != std::string::npos) {
+            command = _inputBuffer.substr(0, newline);
+            _inputBuffer.erase(0, newline + 1);
+            return true;
+        }
+        
+        if (_inputClosed) {
+            return false;
+        }
+        
+        struct pollfd pollFds[2] = {
+            {STDIN_FILENO, POLLIN, 0},
+            {_kitchenManager->getEventFd(), POLLIN, 0}
+        };
+        
+        if (poll(pollFds, 2, -1) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        
+        if (pollFds[1].revents & POLLIN) {
+            _kitchenManager->checkForCompletedPizzas();
+        }
+        
+        if (pollFds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            readInput();
+        }
+    }
+}
+
+void Reception::readInput() {
+    char chunk[INPUT_CHUNK_SIZE];
+    ssize_t result = read(STDIN_FILENO, chunk, sizeof(chunk));
+    
+    if (result > 0) {
+        _inputBuffer.append(chunk, result);
+    } else if (result == 0 || (errno != EINTR && errno != EAGAIN)) {
+        _inputClosed = true;
+    }
+}
+
 void Reception::processCommand(const std::string& command) {
     std::string trimmed = command;
     
@@ -104,20 +162,26 @@ void Reception::handleOrderCommand(const std::string& command) {
         
         std::cout << "Processing " << totalPizzas << " pizza(s)..." << std::endl;
         
+        std::vector<SerializedPizza> pizzas;
+        pizzas.reserve(totalPizzas);
         for (const auto& order : orders) {
             for (int i = 0; i < order.quantity; ++i) {
-                SerializedPizza pizza(order.type, order.size, 
+                pizzas.emplace_back(order.type, order.size, 
                     static_cast<int>(PizzaTypeHelper::getCookingTime(order.type) * _multiplier));
-                
-                std::string pizzaName = PizzaTypeHelper::pizzaTypeToString(order.type) + " " +
-                                      PizzaTypeHelper::pizzaSizeToString(order.size);
-                
-                if (_kitchenManager->distributePizza(pizza)) {
-                    std::cout << "Ordered: " << pizzaName << std::endl;
-                } else {
-                    std::cout << "Failed to order: " << pizzaName << " (no available kitchen)" << std::endl;
-                    LOG_ERROR("Failed to order pizza: " + pizzaName);
-                }
+            }
+        }
+        
+        std::vector<bool> results = _kitchenManager->distributePizzas(pizzas);
+        
+        for (size_t i = 0; i < pizzas.size(); ++i) {
+            std::string pizzaName = PizzaTypeHelper::pizzaTypeToString(pizzas[i].type) + " " +
+                                  PizzaTypeHelper::pizzaSizeToString(pizzas[i].size);
+            
+            if (results[i]) {
+                std::cout << "Ordered: " << pizzaName << std::endl;
+            } else {
+                std::cout << "Failed to order: " << pizzaName << " (no available kitchen)" << std::endl;
+                LOG_ERROR("Failed to order pizza: " + pizzaName);
             }
         }
         
@@ -131,7 +195,7 @@ void Reception::handleOrderCommand(const std::string& command) {
 }
 
 void Reception::handleStatusCommand() {
-    _kitchenManager->displayStatus();
+    _kitchenManager->displayStatus(_kitchenManager->collectKitchenStatuses());
 }
 
 void Reception::showHelp() {
@@ -165,6 +229,10 @@ void Reception::displayWelcome() {
     std::cout << "  Cooking multiplier: " << _multiplier << std::endl;
     std::cout << "  Cooks per kitchen: " << _numCooksPerKitchen << std::endl;
     std::cout << "  Restock time: " << _restockTime << "ms" << std::endl;
+    std::cout << "  IPC transport: " << IPCFactory::transportToString(_transport) << std::endl;
+    std::cout << "  Scheduling policy: " << SchedulingPolicyFactory::policyToString(_scheduling) << std::endl;
+    std::cout << "  Status push window: " << _statusWindowMs << "ms" << std::endl;
+    std::cout << "  Warm kitchens: " << _warmKitchens << std::endl;
 }
 
 bool Reception::isRunning() const {
@@ -0,0 +1,97 @@
+#include "core/SchedulingPolicies.hpp"
+
+void FifoPolicy::push(const QueuedPizza& pizza) {
+    _queue.push_back(pizza);
+}
+
+bool FifoPolicy::pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) {
+    (void)available;
+    (void)now;
+    
+    if (_queue.empty()) {
+        return false;
+    }
+    
+    pizza = _queue.front();
+    _queue.pop_front();
+    return true;
+}
+
+size_t FifoPolicy::size() const {
+    return _queue.size();
+}
+
+SchedulingPolicyKind FifoPolicy::getKind() const {
+    return FifoScheduling;
+}
+
+ShortestJobPolicy::ShortestJobPolicy(double agingFactor) : _agingFactor(agingFactor) {}
+
+void ShortestJobPolicy::push(const QueuedPizza& pizza) {
+    _queue.push_back(pizza);
+}
+
+bool ShortestJobPolicy::pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) {
+    (void)available;
+    
+    if (_queue.empty()) {
+        return false;
+    }
+    
+    auto best = _queue.begin();
+    double bestScore = 0;
+    
+    for (auto it = _queue.begin(); it != _queue.end(); ++it) {
+        double waitedMs = std::chrono::duration<double, std::milli>(now - it->enqueuedAt).count();
+        double score = it->pizza.cookingTime - _agingFactor * waitedMs;
+        
+        if (it == _queue.begin() || score < bestScore) {
+            best = it;
+            bestScore = score;
+        }
+    }
+    
+    pizza = *best;
+    _queue.erase(best);
+    return true;
+}
+
+size_t ShortestJobPolicy::size() const {
+    return _queue.size();
+}
+
+SchedulingPolicyKind ShortestJobPolicy::getKind() const {
+    return ShortestJobScheduling;
+}
+
+void IngredientAwarePolicy::push(const QueuedPizza& pizza) {
+    _queue.push_back(pizza);
+}
+
+bool IngredientAwarePolicy::pop(QueuedPizza& pizza, IngredientMask available, Clock::time_point now) {
+    (void)now;
+    
+    if (_queue.empty()) {
+        return false;
+    }
+    
+    auto chosen = _queue.begin();
+    for (auto it = _queue.begin(); it != _queue.end(); ++it) {
+        if ((PizzaTypeHelper::getIngredientMask(it->pizza.type) & ~available) == 0) {
+            chosen = it;
+            break;
+        }
+    }
+    
+    pizza = *chosen;
+    _queue.erase(chosen);
+    return true;
+}
+
+size_t IngredientAwarePolicy::size() const {
+    return _queue.size();
+}
+
+SchedulingPolicyKind IngredientAwarePolicy::getKind() const {
+    return IngredientAwareScheduling;
+}
@@ -0,0 +1,29 @@
+#include "core/SchedulingPolicyFactory.hpp"
+#include "core/SchedulingPolicies.hpp"
+#include <stdexcept>
+
+std::unique_ptr<ISchedulingPolicy> SchedulingPolicyFactory::createPolicy(SchedulingPolicyKind kind) {
+    switch (kind) {
+        case ShortestJobScheduling: return std::make_unique<ShortestJobPolicy>();
+        case IngredientAwareScheduling: return std::make_unique<IngredientAwarePolicy>();
+        case FifoScheduling:
+        default: return std::make_unique<FifoPolicy>();
+    }
+}
+
+SchedulingPolicyKind SchedulingPolicyFactory::stringToPolicy(const std::string& str) {
+    if (str == "fifo") return FifoScheduling;
+    if (str == "sjf") return ShortestJobScheduling;
+    if (str == "ingredients") return IngredientAwareScheduling;
+    
+    throw std::invalid_argument("Unknown scheduling policy: " + str);
+}
+
+std::string SchedulingPolicyFactory::policyToString(SchedulingPolicyKind kind) {
+    switch (kind) {
+        case FifoScheduling: return "fifo";
+        case ShortestJobScheduling: return "sjf";
+        case IngredientAwareScheduling: return "ingredients";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,31 @@
+#include "ipc/IPCFactory.hpp"
+#include "ipc/PipeIPC.hpp"
+#include "ipc/ShmRingIPC.hpp"
+#include "ipc/SeqPacketIPC.hpp"
+#include <stdexcept>
+
+std::unique_ptr<IIPC> IPCFactory::createIPC(IPCTransport transport) {
+    switch (transport) {
+        case ShmRingTransport: return std::make_unique<ShmRingIPC>();
+        case SeqPacketTransport: return std::make_unique<SeqPacketIPC>();
+        case PipeTransport:
+        default: return std::make_unique<PipeIPC>();
+    }
+}
+
+IPCTransport IPCFactory::stringToTransport(const std::string& str) {
+    if (str == "pipe") return PipeTransport;
+    if (str == "shm") return ShmRingTransport;
+    if (str == "seqpacket") return SeqPacketTransport;
+    
+    throw std::invalid_argument("Unknown IPC transport: " + str);
+}
+
+std::string IPCFactory::transportToString(IPCTransport transport) {
+    switch (transport) {
+        case PipeTransport: return "pipe";
+        case ShmRingTransport: return "shm";
+        case SeqPacketTransport: return "seqpacket";
+        default: return "unknown";
+    }
+}
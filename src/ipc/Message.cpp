@@ -0,0 +1,101 @@
+#include "ipc/Message.hpp"
+#include <cstring>
+
+IPCMessage::IPCMessage() : _size(0), _type(UnknownMessage), _correlationId(0) {}
+
+char* IPCMessage::resize(size_t size) {
+    if (_buffer.size() < size) {
+        _buffer.resize(size);
+    }
+    _size = size;
+    _type = UnknownMessage;
+    _correlationId = 0;
+    return _buffer.data();
+}
+
+void IPCMessage::assign(const char* data, size_t size) {
+    std::memcpy(resize(size), data, size);
+    parse();
+}
+
+void IPCMessage::parse() {
+    _type = UnknownMessage;
+    _correlationId = 0;
+    
+    if (_size < MESSAGE_HEADER_SIZE) {
+        return;
+    }
+    
+    const unsigned char* header = reinterpret_cast<const unsigned char*>(_buffer.data());
+    unsigned int type = header[0] | (header[1] << 8);
+    uint32_t correlationId = static_cast<uint32_t>(Serializer::readInt32(_buffer.data() + 4));
+    uint32_t payloadSize = static_cast<uint32_t>(Serializer::readInt32(_buffer.data() + 8));
+    
+    if (type < MessageTypeCount && payloadSize == _size - MESSAGE_HEADER_SIZE) {
+        _type = static_cast<MessageType>(type);
+        _correlationId = correlationId;
+    }
+}
+
+void IPCMessage::clear() {
+    _size = 0;
+    _type = UnknownMessage;
+    _correlationId = 0;
+}
+
+bool IPCMessage::empty() const {
+    return _size == 0;
+}
+
+MessageType IPCMessage::getType() const {
+    return _type;
+}
+
+uint32_t IPCMessage::getCorrelationId() const {
+    return _correlationId;
+}
+
+const char* IPCMessage::getPayload() const {
+    return _buffer.data() + MESSAGE_HEADER_SIZE;
+}
+
+size_t IPCMessage::getPayloadSize() const {
+    return _type == UnknownMessage ? 0 : _size - MESSAGE_HEADER_SIZE;
+}
+
+std::string IPCMessage::encode(MessageType type, uint32_t correlationId) {
+    return encodeHeader(type, 0, correlationId);
+}
+
+std::string IPCMessage::encode(MessageType type, const SerializedPizza& pizza, uint32_t correlationId) {
+    std::string message = encodeHeader(type, SerializedPizza::WIRE_SIZE, correlationId);
+    pizza.packInto(&message[MESSAGE_HEADER_SIZE]);
+    return message;
+}
+
+std::string IPCMessage::encode(MessageType type, const KitchenStatus& status, uint32_t correlationId) {
+    std::string message = encodeHeader(type, KitchenStatus::WIRE_SIZE, correlationId);
+    status.packInto(&message[MESSAGE_HEADER_SIZE]);
+    return message;
+}
+
+std::string IPCMessage::encode(MessageType type, const StatusDelta& delta, uint32_t correlationId) {
+    std::string message = encodeHeader(type, delta.wireSize(), correlationId);
+    delta.packInto(&message[MESSAGE_HEADER_SIZE]);
+    return message;
+}
+
+std::string IPCMessage::encode(MessageType type, const KitchenMetricsSnapshot& metrics, uint32_t correlationId) {
+    std::string message = encodeHeader(type, KitchenMetricsSnapshot::WIRE_SIZE, correlationId);
+    metrics.packInto(&message[MESSAGE_HEADER_SIZE]);
+    return message;
+}
+
+std::string IPCMessage::encodeHeader(MessageType type, size_t payloadSize, uint32_t correlationId) {
+    std::string message(MESSAGE_HEADER_SIZE + payloadSize, '\0');
+    message[0] = static_cast<char>(type & 0xFF);
+    message[1] = static_cast<char>((type >> 8) & 0xFF);
+    Serializer::writeInt32(&message[4], static_cast<int32_t>(correlationId));
+    Serializer::writeInt32(&message[8], static_cast<int32_t>(payloadSize));
+    return message;
+}
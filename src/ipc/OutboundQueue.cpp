@@ -0,0 +1,67 @@
+#include "ipc/OutboundQueue.hpp"
+#include <cstring>
+
+OutboundQueue::OutboundQueue(size_t capacity) : _start(0), _capacity(capacity) {}
+
+bool OutboundQueue::empty() const {
+    return size() == 0;
+}
+
+size_t OutboundQueue::size() const {
+    return _buffer.size() - _start;
+}
+
+bool OutboundQueue::canAccept(size_t bytes) const {
+    return size() + bytes <= _capacity;
+}
+
+void OutboundQueue::append(const void* data, size_t size) {
+    if (_start > 0 && _start == _buffer.size()) {
+        _buffer.clear();
+        _start = 0;
+    }
+    
+    const char* bytes = static_cast<const char*>(data);
+    _buffer.insert(_buffer.end(), bytes, bytes + size);
+}
+
+void OutboundQueue::appendFrame(const std::string& message) {
+    uint32_t length = message.length();
+    append(&length, sizeof(length));
+    append(message.data(), length);
+}
+
+const char* OutboundQueue::data() const {
+    return _buffer.data() + _start;
+}
+
+bool OutboundQueue::peekFrame(const char*& payload, uint32_t& length) const {
+    if (size() < sizeof(length)) {
+        return false;
+    }
+    
+    std::memcpy(&length, data(), sizeof(length));
+    payload = data() + sizeof(length);
+    return true;
+}
+
+void OutboundQueue::consume(size_t bytes) {
+    _start += bytes;
+    
+    if (_start >= _buffer.size()) {
+        _buffer.clear();
+        _start = 0;
+    } else if (_start > _capacity) {
+        _buffer.erase(_buffer.begin(), _buffer.begin() + _start);
+        _start = 0;
+    }
+}
+
+void OutboundQueue::clear() {
+    _buffer.clear();
+    _start = 0;
+}
+
+size_t OutboundQueue::frameSize(const std::string& message) {
+    return sizeof(uint32_t) + message.length();
+}
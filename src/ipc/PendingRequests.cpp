@@ -0,0 +1,86 @@
+#include "ipc/PendingRequests.hpp"
+#include <vector>
+
+PendingRequests::PendingRequests() : _nextId(1) {}
+
+uint32_t PendingRequests::add(int owner, int timeoutMs, Callback callback) {
+    uint32_t correlationId = _nextId++;
+    if (_nextId == 0) {
+        _nextId = 1;
+    }
+    
+    Request request;
+    request.owner = owner;
+    request.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    request.callback = std::move(callback);
+    _requests[correlationId] = std::move(request);
+    
+    return correlationId;
+}
+
+bool PendingRequests::complete(const IPCMessage& message) {
+    auto it = _requests.find(message.getCorrelationId());
+    if (it == _requests.end()) {
+        return false;
+    }
+    
+    finish(it, &message);
+    return true;
+}
+
+void PendingRequests::cancel(uint32_t correlationId) {
+    auto it = _requests.find(correlationId);
+    if (it != _requests.end()) {
+        finish(it, nullptr);
+    }
+}
+
+void PendingRequests::cancelOwner(int owner) {
+    std::vector<uint32_t> cancelled;
+    
+    for (const auto& entry : _requests) {
+        if (entry.second.owner == owner) {
+            cancelled.push_back(entry.first);
+        }
+    }
+    
+    for (uint32_t correlationId : cancelled) {
+        cancel(correlationId);
+    }
+}
+
+void PendingRequests::expire() {
+    std::vector<uint32_t> expired;
+    auto now = std::chrono::steady_clock::now();
+    
+    for (const auto& entry : _requests) {
+        if (entry.second.deadline <= now) {
+            expired.push_back(entry.first);
+        }
+    }
+    
+    for (uint32_t correlationId : expired) {
+        cancel(correlationId);
+    }
+}
+
+bool PendingRequests::contains(uint32_t correlationId) const {
+    return _requests.find(correlationId) != _requests.end();
+}
+
+bool PendingRequests::empty() const {
+    return _requests.empty();
+}
+
+size_t PendingRequests::size() const {
+    return _requests.size();
+}
+
+void PendingRequests::finish(std::unordered_map<uint32_t, Request>::iterator it, const IPCMessage* response) {
+    Callback callback = std::move(it->second.callback);
+    _requests.erase(it);
+    
+    if (callback) {
+        callback(response);
+    }
+}
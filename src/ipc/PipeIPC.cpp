@@ -5,10 +5,18 @@
 #include <cstring>
 #include <errno.h>
 #include <cstdint>
+#include <climits>
+#include <algorithm>
+
+namespace {
+    const size_t READ_CHUNK_SIZE = 64 * 1024;
+}
 
 PipeIPC::PipeIPC() : _parentToChildRead(-1), _parentToChildWrite(-1),
                      _childToParentRead(-1), _childToParentWrite(-1),
-                     _isParent(true), _closed(false) {}
+                     _isParent(true), _closed(false),
+                     _inputBuffer(READ_CHUNK_SIZE), _inputStart(0), _inputEnd(0),
+                     _channelFull(false) {}
 
 PipeIPC::~PipeIPC() {
     close();
@@ -30,6 +38,10 @@ bool PipeIPC::createPipes() {
     return true;
 }
 
+bool PipeIPC::create() {
+    return createPipes();
+}
+
 void PipeIPC::setupParent() {
     _isParent = true;
     if (_parentToChildRead != -1) {
@@ -40,6 +52,8 @@ void PipeIPC::setupParent() {
         ::close(_childToParentWrite);
         _childToParentWrite = -1;
     }
+    setNonBlocking(_childToParentRead);
+    setNonBlocking(_parentToChildWrite);
 }
 
 void PipeIPC::setupChild() {
@@ -52,60 +66,35 @@ void PipeIPC::setupChild() {
         ::close(_childToParentRead);
         _childToParentRead = -1;
     }
+    setNonBlocking(_parentToChildRead);
+    setNonBlocking(_childToParentWrite);
 }
 
 bool PipeIPC::send(const std::string& message) {
-    if (_closed) {
-        return false;
-    }
-    
-    int writeFd = _isParent ? _parentToChildWrite : _childToParentWrite;
-    if (writeFd == -1) {
-        return false;
-    }
-    
-    uint32_t length = message.length();
-    
-    if (!writeData(writeFd, &length, sizeof(length))) {
-        return false;
-    }
-    
-    if (!writeData(writeFd, message.c_str(), length)) {
-        return false;
-    }
-    
-    return true;
+    return sendFrames(&message, 1);
+}
+
+bool PipeIPC::sendBatch(const std::vector<std::string>& messages) {
+    return sendFrames(messages.data(), messages.size());
 }
 
-std::string PipeIPC::receive() {
+bool PipeIPC::receive(IPCMessage& message) {
     if (_closed) {
-        return "";
+        return false;
     }
     
     int readFd = _isParent ? _childToParentRead : _parentToChildRead;
     if (readFd == -1) {
-        return "";
-    }
-    
-    int flags = fcntl(readFd, F_GETFL, 0);
-    fcntl(readFd, F_SETFL, flags | O_NONBLOCK);
-    
-    uint32_t length;
-    
-    if (!readData(readFd, &length, sizeof(length))) {
-        fcntl(readFd, F_SETFL, flags);
-        return "";
+        return false;
     }
     
-    std::string message(length, '\0');
-    if (!readData(readFd, &message[0], length)) {
-        fcntl(readFd, F_SETFL, flags);
-        return "";
+    if (!extractFrame(message)) {
+        if (!fillInputBuffer(readFd) || !extractFrame(message)) {
+            return false;
+        }
     }
     
-    fcntl(readFd, F_SETFL, flags);
-    
-    return message;
+    return true;
 }
 
 bool PipeIPC::isReady() const {
@@ -141,69 +130,186 @@ void PipeIPC::close() {
     _closed = true;
 }
 
+int PipeIPC::getReadFd() const {
+    return _isParent ? _childToParentRead : _parentToChildRead;
+}
+
 IIPC& PipeIPC::operator<<(const SerializedPizza& pizza) {
-    std::string data = pizza.pack();
-    send("PIZZA:" + data);
+    send(IPCMessage::encode(PizzaMessage, pizza));
     return *this;
 }
 
 IIPC& PipeIPC::operator>>(SerializedPizza& pizza) {
-    std::string message = receive();
-    if (message.substr(0, 6) == "PIZZA:") {
-        pizza.unpack(message.substr(6));
+    IPCMessage message;
+    if (receive(message) && message.getType() == PizzaMessage) {
+        pizza.unpack(message.getPayload(), message.getPayloadSize());
     }
     return *this;
 }
 
 IIPC& PipeIPC::operator<<(const KitchenStatus& status) {
-    std::string data = status.pack();
-    send("STATUS:" + data);
+    send(IPCMessage::encode(StatusMessage, status));
     return *this;
 }
 
 IIPC& PipeIPC::operator>>(KitchenStatus& status) {
-    std::string message = receive();
-    if (message.substr(0, 7) == "STATUS:") {
-        status.unpack(message.substr(7));
+    IPCMessage message;
+    if (receive(message) && message.getType() == StatusMessage) {
+        status.unpack(message.getPayload(), message.getPayloadSize());
     }
     return *this;
 }
 
-bool PipeIPC::writeData(int fd, const void* data, size_t size) {
-    const char* ptr = static_cast<const char*>(data);
-    size_t written = 0;
+int PipeIPC::getWriteFd() const {
+    return _isParent ? _parentToChildWrite : _childToParentWrite;
+}
+
+bool PipeIPC::flush() {
+    int writeFd = getWriteFd();
+    if (_closed || writeFd == -1) {
+        return false;
+    }
     
-    while (written < size) {
-        ssize_t result = write(fd, ptr + written, size - written);
+    while (!_outputQueue.empty()) {
+        ssize_t result = write(writeFd, _outputQueue.data(), _outputQueue.size());
         if (result == -1) {
-            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            if (errno == EINTR) {
                 continue;
             }
-            return false;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
         }
-        written += result;
+        _outputQueue.consume(result);
     }
     
     return true;
 }
 
-bool PipeIPC::readData(int fd, void* data, size_t size) {
-    char* ptr = static_cast<char*>(data);
-    size_t bytesRead = 0;
+bool PipeIPC::hasPendingOutput() const {
+    return !_outputQueue.empty();
+}
+
+bool PipeIPC::isChannelFull() const {
+    return _channelFull;
+}
+
+bool PipeIPC::sendFrames(const std::string* messages, size_t count) {
+    int writeFd = getWriteFd();
+    if (_closed || writeFd == -1) {
+        return false;
+    }
     
-    while (bytesRead < size) {
-        ssize_t result = read(fd, ptr + bytesRead, size - bytesRead);
+    size_t totalSize = 0;
+    for (size_t i = 0; i < count; ++i) {
+        totalSize += OutboundQueue::frameSize(messages[i]);
+    }
+    
+    _channelFull = !_outputQueue.canAccept(totalSize);
+    if (_channelFull) {
+        return false;
+    }
+    
+    if (!_outputQueue.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            _outputQueue.appendFrame(messages[i]);
+        }
+        return flush();
+    }
+    
+    std::vector<uint32_t> lengths(count);
+    std::vector<struct iovec> iov(count * 2);
+    
+    for (size_t i = 0; i < count; ++i) {
+        lengths[i] = messages[i].length();
+        iov[2 * i].iov_base = &lengths[i];
+        iov[2 * i].iov_len = sizeof(uint32_t);
+        iov[2 * i + 1].iov_base = const_cast<char*>(messages[i].data());
+        iov[2 * i + 1].iov_len = lengths[i];
+    }
+    
+    return writeVector(writeFd, iov.data(), static_cast<int>(iov.size()));
+}
+
+bool PipeIPC::writeVector(int fd, struct iovec* iov, int count) {
+    while (count > 0) {
+        ssize_t result = writev(fd, iov, std::min(count, IOV_MAX));
         if (result == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
             if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                return false;
+                for (int i = 0; i < count; ++i) {
+                    _outputQueue.append(iov[i].iov_base, iov[i].iov_len);
+                }
+                return true;
             }
             return false;
         }
-        if (result == 0) {
-            return false;
+        
+        size_t written = result;
+        while (count > 0 && written >= iov->iov_len) {
+            written -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+            iov->iov_len -= written;
         }
-        bytesRead += result;
     }
     
     return true;
+}
+
+bool PipeIPC::fillInputBuffer(int fd) {
+    if (_inputStart > 0) {
+        std::memmove(_inputBuffer.data(), _inputBuffer.data() + _inputStart, _inputEnd - _inputStart);
+        _inputEnd -= _inputStart;
+        _inputStart = 0;
+    }
+    
+    if (_inputEnd == _inputBuffer.size()) {
+        _inputBuffer.resize(_inputBuffer.size() * 2);
+    }
+    
+    ssize_t result = read(fd, _inputBuffer.data() + _inputEnd, _inputBuffer.size() - _inputEnd);
+    if (result <= 0) {
+        return false;
+    }
+    
+    _inputEnd += result;
+    return true;
+}
+
+bool PipeIPC::extractFrame(IPCMessage& message) {
+    size_t available = _inputEnd - _inputStart;
+    uint32_t length;
+    
+    if (available < sizeof(length)) {
+        return false;
+    }
+    
+    std::memcpy(&length, _inputBuffer.data() + _inputStart, sizeof(length));
+    if (available - sizeof(length) < length) {
+        return false;
+    }
+    
+    message.assign(_inputBuffer.data() + _inputStart + sizeof(length), length);
+    _inputStart += sizeof(length) + length;
+    
+    if (_inputStart == _inputEnd) {
+        _inputStart = 0;
+        _inputEnd = 0;
+    }
+    
+    return true;
+}
+
+void PipeIPC::setNonBlocking(int fd) {
+    if (fd == -1) {
+        return;
+    }
+    
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
 }
\ No newline at end of file
@@ -0,0 +1,254 @@
+#include "ipc/SeqPacketIPC.hpp"
+#include "utils/Logger.hpp"
+#include <unistd.h>
+#include <errno.h>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+
+SeqPacketIPC::SeqPacketIPC() : _parentSocket(-1), _childSocket(-1),
+                               _isParent(true), _closed(false),
+                               _receivedCount(0), _receivedIndex(0), _channelFull(false) {}
+
+SeqPacketIPC::~SeqPacketIPC() {
+    close();
+}
+
+bool SeqPacketIPC::create() {
+    int sockets[2];
+    
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) == -1) {
+        return false;
+    }
+    
+    _parentSocket = sockets[0];
+    _childSocket = sockets[1];
+    
+    return true;
+}
+
+void SeqPacketIPC::setupParent() {
+    _isParent = true;
+    if (_childSocket != -1) {
+        ::close(_childSocket);
+        _childSocket = -1;
+    }
+}
+
+void SeqPacketIPC::setupChild() {
+    _isParent = false;
+    if (_parentSocket != -1) {
+        ::close(_parentSocket);
+        _parentSocket = -1;
+    }
+}
+
+bool SeqPacketIPC::send(const std::string& message) {
+    return sendFrames(&message, 1);
+}
+
+bool SeqPacketIPC::sendBatch(const std::vector<std::string>& messages) {
+    return sendFrames(messages.data(), messages.size());
+}
+
+bool SeqPacketIPC::receive(IPCMessage& message) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    while (true) {
+        if (_receivedIndex == _receivedCount && !receiveBatch()) {
+            return false;
+        }
+        
+        unsigned int index = _receivedIndex++;
+        if (_receiveHeaders[index].msg_len == 0) {
+            _receivedIndex = _receivedCount;
+            return false;
+        }
+        if (_receiveHeaders[index].msg_hdr.msg_flags & MSG_TRUNC) {
+            LOG_WARNING("Dropping datagram larger than " + std::to_string(SEQPACKET_MAX_MESSAGE_SIZE) +
+                        " bytes on seqpacket channel");
+            continue;
+        }
+        
+        message.assign(&_receiveBuffer[index * SEQPACKET_MAX_MESSAGE_SIZE],
+                       _receiveHeaders[index].msg_len);
+        return true;
+    }
+}
+
+bool SeqPacketIPC::isReady() const {
+    return !_closed && getSocket() != -1;
+}
+
+void SeqPacketIPC::close() {
+    if (_closed) {
+        return;
+    }
+    
+    if (_parentSocket != -1) {
+        ::close(_parentSocket);
+        _parentSocket = -1;
+    }
+    if (_childSocket != -1) {
+        ::close(_childSocket);
+        _childSocket = -1;
+    }
+    
+    _closed = true;
+}
+
+int SeqPacketIPC::getReadFd() const {
+    return getSocket();
+}
+
+int SeqPacketIPC::getWriteFd() const {
+    return getSocket();
+}
+
+bool SeqPacketIPC::flush() {
+    if (!isReady()) {
+        return false;
+    }
+    
+    const char* payload;
+    uint32_t length;
+    
+    while (_outputQueue.peekFrame(payload, length)) {
+        ssize_t result = ::send(getSocket(), payload, length, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (result == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        _outputQueue.consume(sizeof(length) + length);
+    }
+    
+    return true;
+}
+
+bool SeqPacketIPC::hasPendingOutput() const {
+    return !_outputQueue.empty();
+}
+
+bool SeqPacketIPC::isChannelFull() const {
+    return _channelFull;
+}
+
+IIPC& SeqPacketIPC::operator<<(const SerializedPizza& pizza) {
+    send(IPCMessage::encode(PizzaMessage, pizza));
+    return *this;
+}
+
+IIPC& SeqPacketIPC::operator>>(SerializedPizza& pizza) {
+    IPCMessage message;
+    if (receive(message) && message.getType() == PizzaMessage) {
+        pizza.unpack(message.getPayload(), message.getPayloadSize());
+    }
+    return *this;
+}
+
+IIPC& SeqPacketIPC::operator<<(const KitchenStatus& status) {
+    send(IPCMessage::encode(StatusMessage, status));
+    return *this;
+}
+
+IIPC& SeqPacketIPC::operator>>(KitchenStatus& status) {
+    IPCMessage message;
+    if (receive(message) && message.getType() == StatusMessage) {
+        status.unpack(message.getPayload(), message.getPayloadSize());
+    }
+    return *this;
+}
+
+int SeqPacketIPC::getSocket() const {
+    return _isParent ? _parentSocket : _childSocket;
+}
+
+bool SeqPacketIPC::sendFrames(const std::string* messages, size_t count) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    size_t totalSize = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (messages[i].length() > SEQPACKET_MAX_MESSAGE_SIZE) {
+            return false;
+        }
+        totalSize += OutboundQueue::frameSize(messages[i]);
+    }
+    
+    _channelFull = !_outputQueue.canAccept(totalSize);
+    if (_channelFull) {
+        return false;
+    }
+    
+    size_t sent = 0;
+    if (_outputQueue.empty() && !sendDirect(messages, count, sent)) {
+        return false;
+    }
+    
+    for (; sent < count; ++sent) {
+        _outputQueue.appendFrame(messages[sent]);
+    }
+    
+    return flush();
+}
+
+bool SeqPacketIPC::sendDirect(const std::string* messages, size_t count, size_t& sent) {
+    std::vector<struct iovec> vectors(count);
+    std::vector<struct mmsghdr> headers(count);
+    
+    for (size_t i = 0; i < count; ++i) {
+        vectors[i].iov_base = const_cast<char*>(messages[i].data());
+        vectors[i].iov_len = messages[i].length();
+        std::memset(&headers[i], 0, sizeof(headers[i]));
+        headers[i].msg_hdr.msg_iov = &vectors[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+    
+    sent = 0;
+    while (sent < count) {
+        unsigned int chunk = std::min<size_t>(count - sent, IOV_MAX);
+        int result = sendmmsg(getSocket(), &headers[sent], chunk, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (result == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        sent += result;
+    }
+    
+    return true;
+}
+
+bool SeqPacketIPC::receiveBatch() {
+    if (_receiveHeaders.empty()) {
+        _receiveBuffer.resize(SEQPACKET_RECEIVE_BATCH * SEQPACKET_MAX_MESSAGE_SIZE);
+        _receiveHeaders.resize(SEQPACKET_RECEIVE_BATCH);
+        _receiveVectors.resize(SEQPACKET_RECEIVE_BATCH);
+    }
+    
+    for (unsigned int i = 0; i < SEQPACKET_RECEIVE_BATCH; ++i) {
+        _receiveVectors[i].iov_base = &_receiveBuffer[i * SEQPACKET_MAX_MESSAGE_SIZE];
+        _receiveVectors[i].iov_len = SEQPACKET_MAX_MESSAGE_SIZE;
+        std::memset(&_receiveHeaders[i], 0, sizeof(_receiveHeaders[i]));
+        _receiveHeaders[i].msg_hdr.msg_iov = &_receiveVectors[i];
+        _receiveHeaders[i].msg_hdr.msg_iovlen = 1;
+    }
+    
+    int result = recvmmsg(getSocket(), _receiveHeaders.data(), SEQPACKET_RECEIVE_BATCH,
+                          MSG_DONTWAIT, nullptr);
+    if (result <= 0) {
+        _receivedCount = 0;
+        _receivedIndex = 0;
+        return false;
+    }
+    
+    _receivedCount = result;
+    _receivedIndex = 0;
+    return true;
+}
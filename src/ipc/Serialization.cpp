@@ -1,66 +1,220 @@
 #include "ipc/Serialization.hpp"
 #include <sstream>
 #include <algorithm>
+#include <stdexcept>
+
+constexpr size_t SerializedPizza::WIRE_SIZE;
+constexpr size_t KitchenStatus::WIRE_SIZE;
+constexpr size_t KitchenMetricsSnapshot::WIRE_SIZE;
+constexpr size_t StatusDelta::HEADER_SIZE;
+constexpr size_t StatusDelta::MAX_WIRE_SIZE;
+
+namespace {
+    std::array<int32_t, StatusDelta::FIELD_COUNT> statusFields(const KitchenStatus& status) {
+        std::array<int32_t, StatusDelta::FIELD_COUNT> fields = {{
+            status.activeCooks, status.pizzasInQueue, status.blockedPizzas,
+            status.meanQueueWaitUs, status.p99QueueWaitUs
+        }};
+        
+        for (int i = 0; i < INGREDIENT_COUNT; ++i) {
+            fields[5 + i] = status.ingredients[i];
+        }
+        return fields;
+    }
+    
+    int* statusField(KitchenStatus& status, int field) {
+        switch (field) {
+            case 0: return &status.activeCooks;
+            case 1: return &status.pizzasInQueue;
+            case 2: return &status.blockedPizzas;
+            case 3: return &status.meanQueueWaitUs;
+            case 4: return &status.p99QueueWaitUs;
+            default: return &status.ingredients[field - 5];
+        }
+    }
+}
 
 SerializedPizza::SerializedPizza(PizzaType t, PizzaSize s, int ct, bool cooked)
     : type(t), size(s), cookingTime(ct), isCooked(cooked) {}
 
 std::string SerializedPizza::pack() const {
-    std::ostringstream oss;
-    oss << static_cast<int>(type) << "|" 
-        << static_cast<int>(size) << "|" 
-        << cookingTime << "|" 
-        << (isCooked ? 1 : 0);
-    return oss.str();
+    std::string data(WIRE_SIZE, '\0');
+    packInto(&data[0]);
+    return data;
+}
+
+void SerializedPizza::packInto(char* out) const {
+    out[0] = static_cast<char>(WIRE_FORMAT_VERSION);
+    out[1] = static_cast<char>(type);
+    out[2] = static_cast<char>(size);
+    out[3] = static_cast<char>(isCooked ? 1 : 0);
+    Serializer::writeInt32(out + 4, cookingTime);
 }
 
 void SerializedPizza::unpack(const std::string& data) {
-    auto parts = Serializer::split(data, '|');
-    if (parts.size() != 4) {
+    unpack(data.data(), data.size());
+}
+
+void SerializedPizza::unpack(const char* data, size_t length) {
+    if (length != WIRE_SIZE || static_cast<uint8_t>(data[0]) != WIRE_FORMAT_VERSION) {
         throw std::invalid_argument("Invalid serialized pizza data");
     }
     
-    type = static_cast<PizzaType>(std::stoi(parts[0]));
-    size = static_cast<PizzaSize>(std::stoi(parts[1]));
-    cookingTime = std::stoi(parts[2]);
-    isCooked = std::stoi(parts[3]) == 1;
+    type = static_cast<PizzaType>(static_cast<uint8_t>(data[1]));
+    size = static_cast<PizzaSize>(static_cast<uint8_t>(data[2]));
+    isCooked = (data[3] & 1) != 0;
+    cookingTime = Serializer::readInt32(data + 4);
 }
 
 KitchenStatus::KitchenStatus(int id, int active, int total, int queue, int capacity)
     : kitchenId(id), activeCooks(active), totalCooks(total), 
-      pizzasInQueue(queue), maxCapacity(capacity) {
-    ingredients.resize(9, 5);
+      pizzasInQueue(queue), maxCapacity(capacity), blockedPizzas(0),
+      schedulingPolicy(0), meanQueueWaitUs(0), p99QueueWaitUs(0) {
+    ingredients.fill(5);
 }
 
 std::string KitchenStatus::pack() const {
-    std::ostringstream oss;
-    oss << kitchenId << "|" << activeCooks << "|" << totalCooks << "|" 
-        << pizzasInQueue << "|" << maxCapacity << "|";
+    std::string data(WIRE_SIZE, '\0');
+    packInto(&data[0]);
+    return data;
+}
+
+void KitchenStatus::packInto(char* out) const {
+    out[0] = static_cast<char>(WIRE_FORMAT_VERSION);
+    out[1] = out[2] = out[3] = 0;
+    Serializer::writeInt32(out + 4, kitchenId);
+    Serializer::writeInt32(out + 8, activeCooks);
+    Serializer::writeInt32(out + 12, totalCooks);
+    Serializer::writeInt32(out + 16, pizzasInQueue);
+    Serializer::writeInt32(out + 20, maxCapacity);
+    Serializer::writeInt32(out + 24, blockedPizzas);
+    Serializer::writeInt32(out + 28, schedulingPolicy);
+    Serializer::writeInt32(out + 32, meanQueueWaitUs);
+    Serializer::writeInt32(out + 36, p99QueueWaitUs);
     
-    for (size_t i = 0; i < ingredients.size(); ++i) {
-        oss << ingredients[i];
-        if (i < ingredients.size() - 1) oss << ",";
+    for (int i = 0; i < INGREDIENT_COUNT; ++i) {
+        Serializer::writeInt32(out + 40 + i * 4, ingredients[i]);
     }
-    
-    return oss.str();
 }
 
 void KitchenStatus::unpack(const std::string& data) {
-    auto parts = Serializer::split(data, '|');
-    if (parts.size() != 6) {
+    unpack(data.data(), data.size());
+}
+
+void KitchenStatus::unpack(const char* data, size_t length) {
+    if (length != WIRE_SIZE || static_cast<uint8_t>(data[0]) != WIRE_FORMAT_VERSION) {
         throw std::invalid_argument("Invalid kitchen status data");
     }
     
-    kitchenId = std::stoi(parts[0]);
-    activeCooks = std::stoi(parts[1]);
-    totalCooks = std::stoi(parts[2]);
-    pizzasInQueue = std::stoi(parts[3]);
-    maxCapacity = std::stoi(parts[4]);
+    kitchenId = Serializer::readInt32(data + 4);
+    activeCooks = Serializer::readInt32(data + 8);
+    totalCooks = Serializer::readInt32(data + 12);
+    pizzasInQueue = Serializer::readInt32(data + 16);
+    maxCapacity = Serializer::readInt32(data + 20);
+    blockedPizzas = Serializer::readInt32(data + 24);
+    schedulingPolicy = Serializer::readInt32(data + 28);
+    meanQueueWaitUs = Serializer::readInt32(data + 32);
+    p99QueueWaitUs = Serializer::readInt32(data + 36);
+    
+    for (int i = 0; i < INGREDIENT_COUNT; ++i) {
+        ingredients[i] = Serializer::readInt32(data + 40 + i * 4);
+    }
+}
+
+void KitchenMetricsSnapshot::packInto(char* out) const {
+    const int fields[] = {
+        kitchenId, uptimeMs, utilization, recentUtilization, pizzasCompleted, starvationEvents,
+        queueWaitMeanUs, queueWaitP50Us, queueWaitP99Us, queueWaitMaxUs,
+        cookTimeMeanUs, cookTimeP50Us, cookTimeP99Us, cookTimeMaxUs
+    };
+    
+    out[0] = static_cast<char>(WIRE_FORMAT_VERSION);
+    out[1] = out[2] = out[3] = 0;
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+        Serializer::writeInt32(out + 4 + i * 4, fields[i]);
+    }
+}
+
+void KitchenMetricsSnapshot::unpack(const char* data, size_t length) {
+    if (length != WIRE_SIZE || static_cast<uint8_t>(data[0]) != WIRE_FORMAT_VERSION) {
+        throw std::invalid_argument("Invalid kitchen metrics data");
+    }
+    
+    int* fields[] = {
+        &kitchenId, &uptimeMs, &utilization, &recentUtilization, &pizzasCompleted, &starvationEvents,
+        &queueWaitMeanUs, &queueWaitP50Us, &queueWaitP99Us, &queueWaitMaxUs,
+        &cookTimeMeanUs, &cookTimeP50Us, &cookTimeP99Us, &cookTimeMaxUs
+    };
     
-    auto ingredientParts = Serializer::split(parts[5], ',');
-    ingredients.clear();
-    for (const auto& ing : ingredientParts) {
-        ingredients.push_back(std::stoi(ing));
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+        *fields[i] = Serializer::readInt32(data + 4 + i * 4);
+    }
+}
+
+StatusDelta::StatusDelta() : changed(0) {
+    values.fill(0);
+}
+
+StatusDelta StatusDelta::between(const KitchenStatus& previous, const KitchenStatus& current) {
+    auto before = statusFields(previous);
+    auto after = statusFields(current);
+    
+    StatusDelta delta;
+    for (int i = 0; i < FIELD_COUNT; ++i) {
+        if (before[i] != after[i]) {
+            delta.changed |= 1u << i;
+            delta.values[i] = after[i];
+        }
+    }
+    return delta;
+}
+
+bool StatusDelta::empty() const {
+    return changed == 0;
+}
+
+void StatusDelta::applyTo(KitchenStatus& status) const {
+    for (int i = 0; i < FIELD_COUNT; ++i) {
+        if (changed & (1u << i)) {
+            *statusField(status, i) = values[i];
+        }
+    }
+}
+
+size_t StatusDelta::wireSize() const {
+    return HEADER_SIZE + __builtin_popcount(changed) * 4;
+}
+
+void StatusDelta::packInto(char* out) const {
+    out[0] = static_cast<char>(WIRE_FORMAT_VERSION);
+    out[1] = out[2] = out[3] = 0;
+    Serializer::writeInt32(out + 4, static_cast<int32_t>(changed));
+    
+    char* cursor = out + HEADER_SIZE;
+    for (int i = 0; i < FIELD_COUNT; ++i) {
+        if (changed & (1u << i)) {
+            Serializer::writeInt32(cursor, values[i]);
+            cursor += 4;
+        }
+    }
+}
+
+void StatusDelta::unpack(const char* data, size_t length) {
+    if (length < HEADER_SIZE || static_cast<uint8_t>(data[0]) != WIRE_FORMAT_VERSION) {
+        throw std::invalid_argument("Invalid status delta data");
+    }
+    
+    changed = static_cast<uint32_t>(Serializer::readInt32(data + 4));
+    if ((changed >> FIELD_COUNT) != 0 || length != wireSize()) {
+        throw std::invalid_argument("Invalid status delta data");
+    }
+    
+    const char* cursor = data + HEADER_SIZE;
+    for (int i = 0; i < FIELD_COUNT; ++i) {
+        if (changed & (1u << i)) {
+            values[i] = Serializer::readInt32(cursor);
+            cursor += 4;
+        }
     }
 }
 
@@ -134,4 +288,21 @@ std::string Serializer::join(const std::vector<std::string>& vec, char delimiter
         if (i < vec.size() - 1) oss << delimiter;
     }
     return oss.str();
+}
+
+void Serializer::writeInt32(char* out, int32_t value) {
+    uint32_t bits = static_cast<uint32_t>(value);
+    out[0] = static_cast<char>(bits & 0xFF);
+    out[1] = static_cast<char>((bits >> 8) & 0xFF);
+    out[2] = static_cast<char>((bits >> 16) & 0xFF);
+    out[3] = static_cast<char>((bits >> 24) & 0xFF);
+}
+
+int32_t Serializer::readInt32(const char* in) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+    uint32_t bits = static_cast<uint32_t>(bytes[0]) |
+                    (static_cast<uint32_t>(bytes[1]) << 8) |
+                    (static_cast<uint32_t>(bytes[2]) << 16) |
+                    (static_cast<uint32_t>(bytes[3]) << 24);
+    return static_cast<int32_t>(bits);
 }
\ No newline at end of file
@@ -0,0 +1,304 @@
+#include "ipc/ShmRingIPC.hpp"
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+ShmRingIPC::ShmRingIPC() : _region(nullptr), _sendRing(nullptr), _receiveRing(nullptr),
+                           _parentToChildEvent(-1), _childToParentEvent(-1),
+                           _creatorPid(-1), _isParent(true), _closed(false), _channelFull(false) {}
+
+ShmRingIPC::~ShmRingIPC() {
+    close();
+}
+
+bool ShmRingIPC::create() {
+    int fd = memfd_create("plazza-ipc", MFD_CLOEXEC);
+    if (fd == -1) {
+        return false;
+    }
+    
+    if (ftruncate(fd, sizeof(ShmRegion)) == -1) {
+        ::close(fd);
+        return false;
+    }
+    
+    void* memory = mmap(nullptr, sizeof(ShmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        return false;
+    }
+    
+    _region = static_cast<ShmRegion*>(memory);
+    for (ShmRing* ring : {&_region->parentToChild, &_region->childToParent}) {
+        new (&ring->head) std::atomic<uint32_t>(0);
+        new (&ring->tail) std::atomic<uint32_t>(0);
+    }
+    
+    _creatorPid = getpid();
+    _parentToChildEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    _childToParentEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    
+    return _parentToChildEvent != -1 && _childToParentEvent != -1;
+}
+
+void ShmRingIPC::setupParent() {
+    _isParent = true;
+    if (_region) {
+        _sendRing = &_region->parentToChild;
+        _receiveRing = &_region->childToParent;
+    }
+}
+
+void ShmRingIPC::setupChild() {
+    _isParent = false;
+    if (_region) {
+        _sendRing = &_region->childToParent;
+        _receiveRing = &_region->parentToChild;
+    }
+    
+    if (prctl(PR_SET_PDEATHSIG, SIGTERM) == -1 || getppid() != _creatorPid) {
+        raise(SIGTERM);
+    }
+}
+
+bool ShmRingIPC::send(const std::string& message) {
+    return sendFrames(&message, 1);
+}
+
+bool ShmRingIPC::sendBatch(const std::vector<std::string>& messages) {
+    return sendFrames(messages.data(), messages.size());
+}
+
+bool ShmRingIPC::receive(IPCMessage& message) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    uint32_t head = _receiveRing->head.load(std::memory_order_relaxed);
+    if (_receiveRing->tail.load() == head) {
+        clearNotification();
+        if (_receiveRing->tail.load() == head) {
+            return false;
+        }
+    }
+    
+    uint32_t length;
+    copyOut(_receiveRing, head, &length, sizeof(length));
+    copyOut(_receiveRing, head + sizeof(length), message.resize(length), length);
+    message.parse();
+    _receiveRing->head.store(head + sizeof(length) + length);
+    
+    return true;
+}
+
+bool ShmRingIPC::isReady() const {
+    return !_closed && _sendRing != nullptr && _receiveRing != nullptr;
+}
+
+void ShmRingIPC::close() {
+    if (_closed) {
+        return;
+    }
+    
+    if (_region) {
+        munmap(_region, sizeof(ShmRegion));
+        _region = nullptr;
+    }
+    _sendRing = nullptr;
+    _receiveRing = nullptr;
+    
+    if (_parentToChildEvent != -1) {
+        ::close(_parentToChildEvent);
+        _parentToChildEvent = -1;
+    }
+    if (_childToParentEvent != -1) {
+        ::close(_childToParentEvent);
+        _childToParentEvent = -1;
+    }
+    
+    _closed = true;
+}
+
+int ShmRingIPC::getReadFd() const {
+    return _isParent ? _childToParentEvent : _parentToChildEvent;
+}
+
+int ShmRingIPC::getWriteFd() const {
+    return -1;
+}
+
+bool ShmRingIPC::flush() {
+    if (!isReady()) {
+        return false;
+    }
+    
+    ScopedLock lock(_sendMutex);
+    
+    bool notifyPending = false;
+    drainOutputQueue(notifyPending);
+    if (notifyPending) {
+        notifyPeer();
+    }
+    
+    return true;
+}
+
+bool ShmRingIPC::hasPendingOutput() const {
+    return !_outputQueue.empty();
+}
+
+bool ShmRingIPC::isChannelFull() const {
+    return _channelFull;
+}
+
+bool ShmRingIPC::waitForMessage(int timeoutMs) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    if (_receiveRing->tail.load() != _receiveRing->head.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    
+    struct pollfd pfd;
+    pfd.fd = getReadFd();
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    
+    return poll(&pfd, 1, timeoutMs) > 0;
+}
+
+IIPC& ShmRingIPC::operator<<(const SerializedPizza& pizza) {
+    send(IPCMessage::encode(PizzaMessage, pizza));
+    return *this;
+}
+
+IIPC& ShmRingIPC::operator>>(SerializedPizza& pizza) {
+    IPCMessage message;
+    if (receive(message) && message.getType() == PizzaMessage) {
+        pizza.unpack(message.getPayload(), message.getPayloadSize());
+    }
+    return *this;
+}
+
+IIPC& ShmRingIPC::operator<<(const KitchenStatus& status) {
+    send(IPCMessage::encode(StatusMessage, status));
+    return *this;
+}
+
+IIPC& ShmRingIPC::operator>>(KitchenStatus& status) {
+    IPCMessage message;
+    if (receive(message) && message.getType() == StatusMessage) {
+        status.unpack(message.getPayload(), message.getPayloadSize());
+    }
+    return *this;
+}
+
+int ShmRingIPC::getSendEvent() const {
+    return _isParent ? _parentToChildEvent : _childToParentEvent;
+}
+
+bool ShmRingIPC::sendFrames(const std::string* messages, size_t count) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    ScopedLock lock(_sendMutex);
+    
+    size_t totalSize = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (OutboundQueue::frameSize(messages[i]) > SHM_RING_CAPACITY) {
+            return false;
+        }
+        totalSize += OutboundQueue::frameSize(messages[i]);
+    }
+    
+    _channelFull = !_outputQueue.canAccept(totalSize);
+    if (_channelFull) {
+        return false;
+    }
+    
+    bool notifyPending = false;
+    size_t sent = 0;
+    
+    if (_outputQueue.empty()) {
+        while (sent < count && push(messages[sent].data(), messages[sent].length(), notifyPending)) {
+            ++sent;
+        }
+    }
+    
+    for (; sent < count; ++sent) {
+        _outputQueue.appendFrame(messages[sent]);
+    }
+    
+    drainOutputQueue(notifyPending);
+    if (notifyPending) {
+        notifyPeer();
+    }
+    
+    return true;
+}
+
+bool ShmRingIPC::push(const char* data, uint32_t length, bool& notifyPending) {
+    uint32_t needed = sizeof(length) + length;
+    if (freeSpace() < needed) {
+        return false;
+    }
+    
+    uint32_t tail = _sendRing->tail.load(std::memory_order_relaxed);
+    copyIn(_sendRing, tail, &length, sizeof(length));
+    copyIn(_sendRing, tail + sizeof(length), data, length);
+    _sendRing->tail.store(tail + needed);
+    
+    if (_sendRing->head.load() == tail) {
+        notifyPending = true;
+    }
+    
+    return true;
+}
+
+uint32_t ShmRingIPC::freeSpace() const {
+    uint32_t used = _sendRing->tail.load(std::memory_order_relaxed) - _sendRing->head.load();
+    return SHM_RING_CAPACITY - used;
+}
+
+void ShmRingIPC::drainOutputQueue(bool& notifyPending) {
+    const char* payload;
+    uint32_t length;
+    
+    while (_outputQueue.peekFrame(payload, length) && push(payload, length, notifyPending)) {
+        _outputQueue.consume(sizeof(length) + length);
+    }
+}
+
+void ShmRingIPC::notifyPeer() {
+    uint64_t value = 1;
+    ssize_t result = write(getSendEvent(), &value, sizeof(value));
+    (void)result;
+}
+
+void ShmRingIPC::clearNotification() {
+    uint64_t value;
+    ssize_t result = read(getReadFd(), &value, sizeof(value));
+    (void)result;
+}
+
+void ShmRingIPC::copyIn(ShmRing* ring, uint32_t position, const void* data, uint32_t size) {
+    uint32_t offset = position % SHM_RING_CAPACITY;
+    uint32_t first = std::min(size, SHM_RING_CAPACITY - offset);
+    std::memcpy(ring->data + offset, data, first);
+    std::memcpy(ring->data, static_cast<const char*>(data) + first, size - first);
+}
+
+void ShmRingIPC::copyOut(const ShmRing* ring, uint32_t position, void* data, uint32_t size) {
+    uint32_t offset = position % SHM_RING_CAPACITY;
+    uint32_t first = std::min(size, SHM_RING_CAPACITY - offset);
+    std::memcpy(data, ring->data + offset, first);
+    std::memcpy(static_cast<char*>(data) + first, ring->data, size - first);
+}
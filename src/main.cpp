@@ -11,17 +11,24 @@ void signalHandler(int signum) {
 }
 
 void printUsage() {
-    std::cout << "Usage: ./plazza <multiplier> <cooks_per_kitchen> <restock_time_ms>" << std::endl;
+    std::cout << "Usage: ./plazza <multiplier> <cooks_per_kitchen> <restock_time_ms> [options]" << std::endl;
     std::cout << "  multiplier: Cooking time multiplier (can be between 0-1 for faster cooking)" << std::endl;
     std::cout << "  cooks_per_kitchen: Number of cooks per kitchen" << std::endl;
     std::cout << "  restock_time_ms: Time in milliseconds for ingredient restocking" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --ipc=<pipe|shm|seqpacket>: Kitchen IPC transport (default: pipe)" << std::endl;
+    std::cout << "  --scheduling=<fifo|sjf|ingredients>: Kitchen scheduling policy (default: fifo)" << std::endl;
+    std::cout << "  --status-window=<ms>: Coalescing window for kitchen status updates (default: "
+              << DEFAULT_STATUS_WINDOW_MS << ")" << std::endl;
+    std::cout << "  --warm-kitchens=<n>: Idle kitchens kept pre-forked for scale-out (default: "
+              << DEFAULT_WARM_KITCHENS << ")" << std::endl;
 }
 
 int main(int argc, char* argv[]) {
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
     
-    if (argc != 4) {
+    if (argc < 4) {
         printUsage();
         return 84;
     }
@@ -30,12 +37,37 @@ int main(int argc, char* argv[]) {
         double multiplier = std::stod(argv[1]);
         int cooksPerKitchen = std::stoi(argv[2]);
         int restockTime = std::stoi(argv[3]);
+        IPCTransport transport = PipeTransport;
+        SchedulingPolicyKind scheduling = FifoScheduling;
+        int statusWindowMs = DEFAULT_STATUS_WINDOW_MS;
+        int warmKitchens = DEFAULT_WARM_KITCHENS;
+        
+        for (int i = 4; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option.compare(0, 6, "--ipc=") == 0) {
+                transport = IPCFactory::stringToTransport(option.substr(6));
+            } else if (option.compare(0, 13, "--scheduling=") == 0) {
+                scheduling = SchedulingPolicyFactory::stringToPolicy(option.substr(13));
+            } else if (option.compare(0, 16, "--status-window=") == 0) {
+                statusWindowMs = std::stoi(option.substr(16));
+            } else if (option.compare(0, 16, "--warm-kitchens=") == 0) {
+                warmKitchens = std::stoi(option.substr(16));
+            } else {
+                printUsage();
+                return 84;
+            }
+        }
         
         if (multiplier <= 0 || cooksPerKitchen <= 0 || restockTime <= 0) {
             std::cerr << "Error: All parameters must be positive" << std::endl;
             return 84;
         }
         
+        if (statusWindowMs < 0 || warmKitchens < 0) {
+            std::cerr << "Error: Status window and warm kitchens cannot be negative" << std::endl;
+            return 84;
+        }
+        
         Logger& logger = Logger::getInstance();
         logger.enableConsoleOutput(true);
         logger.enableFileOutput("plazza.log");
@@ -43,9 +75,14 @@ int main(int argc, char* argv[]) {
         
         LOG_INFO("Starting Plazza with multiplier=" + std::to_string(multiplier) + 
                  ", cooks=" + std::to_string(cooksPerKitchen) + 
-                 ", restock=" + std::to_string(restockTime) + "ms");
+                 ", restock=" + std::to_string(restockTime) + "ms" +
+                 ", ipc=" + IPCFactory::transportToString(transport) +
+                 ", scheduling=" + SchedulingPolicyFactory::policyToString(scheduling) +
+                 ", status-window=" + std::to_string(statusWindowMs) + "ms" +
+                 ", warm-kitchens=" + std::to_string(warmKitchens));
         
-        Reception reception(multiplier, cooksPerKitchen, restockTime);
+        Reception reception(multiplier, cooksPerKitchen, restockTime, transport, scheduling,
+                            statusWindowMs, warmKitchens);
         reception.run();
         
     } catch (const PlazzaException& e) {
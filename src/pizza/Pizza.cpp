@@ -22,7 +22,7 @@ PizzaSize Pizza::getSize() const {
 }
 
 std::vector<Ingredient> Pizza::getIngredients() const {
-    return _ingredients;
+    return PizzaTypeHelper::maskToIngredients(_ingredients);
 }
 
 int Pizza::getCookingTime() const {
@@ -43,7 +43,7 @@ void Pizza::cook() {
 }
 
 void Pizza::initializeIngredients() {
-    _ingredients = PizzaTypeHelper::getIngredientsForPizza(_type);
+    _ingredients = PizzaTypeHelper::getIngredientMask(_type);
 }
 
 void Pizza::calculateCookingTime(double multiplier) {
@@ -52,13 +52,8 @@ void Pizza::calculateCookingTime(double multiplier) {
 }
 
 std::string PizzaTypeHelper::pizzaTypeToString(PizzaType type) {
-    switch (type) {
-        case Regina: return "Regina";
-        case Margarita: return "Margarita";
-        case Americana: return "Americana";
-        case Fantasia: return "Fantasia";
-        default: return "Unknown";
-    }
+    const PizzaRecipe* recipe = findRecipe(type);
+    return recipe ? recipe->name : "Unknown";
 }
 
 std::string PizzaTypeHelper::pizzaSizeToString(PizzaSize size) {
@@ -98,26 +93,22 @@ PizzaSize PizzaTypeHelper::stringToPizzaSize(const std::string& str) {
 }
 
 std::vector<Ingredient> PizzaTypeHelper::getIngredientsForPizza(PizzaType type) {
-    switch (type) {
-        case Margarita:
-            return {Dough, Tomato, Gruyere};
-        case Regina:
-            return {Dough, Tomato, Gruyere, Ham, Mushrooms};
-        case Americana:
-            return {Dough, Tomato, Gruyere, Steak};
-        case Fantasia:
-            return {Dough, Tomato, Eggplant, GoatCheese, ChiefLove};
-        default:
-            return {};
+    return maskToIngredients(getIngredientMask(type));
+}
+
+std::vector<Ingredient> PizzaTypeHelper::maskToIngredients(IngredientMask mask) {
+    std::vector<Ingredient> ingredients;
+    
+    for (int bit = 0; bit < INGREDIENT_COUNT; ++bit) {
+        if (mask & (1u << bit)) {
+            ingredients.push_back(static_cast<Ingredient>(1u << bit));
+        }
     }
+    
+    return ingredients;
 }
 
 int PizzaTypeHelper::getCookingTime(PizzaType type) {
-    switch (type) {
-        case Margarita: return 1;
-        case Regina: return 2;  
-        case Americana: return 2;
-        case Fantasia: return 4;
-        default: return 1;
-    }
+    const PizzaRecipe* recipe = findRecipe(type);
+    return recipe ? recipe->cookingTime : 1;
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "utils/LatencyHistogram.hpp"
+#include <algorithm>
+
+LatencyHistogram::LatencyHistogram() : _count(0), _sum(0), _max(0) {
+    _buckets.fill(0);
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t value) {
+    if (value < SUB_BUCKETS) {
+        return value;
+    }
+    
+    int magnitude = 63 - __builtin_clzll(value);
+    uint64_t subBucket = (value >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return (magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    
+    int magnitude = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    uint64_t subBucket = bucket % SUB_BUCKETS;
+    uint64_t width = 1ULL << (magnitude - SUB_BUCKET_BITS);
+    return (1ULL << magnitude) + (subBucket + 1) * width - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    ++_buckets[bucketOf(value)];
+    ++_count;
+    _sum += value;
+    _max = std::max(_max, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        _buckets[i] += other._buckets[i];
+    }
+    _count += other._count;
+    _sum += other._sum;
+    _max = std::max(_max, other._max);
+}
+
+void LatencyHistogram::reset() {
+    _buckets.fill(0);
+    _count = 0;
+    _sum = 0;
+    _max = 0;
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    return _count;
+}
+
+uint64_t LatencyHistogram::getMax() const {
+    return _max;
+}
+
+double LatencyHistogram::getMean() const {
+    return _count == 0 ? 0.0 : static_cast<double>(_sum) / _count;
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const {
+    if (_count == 0) {
+        return 0;
+    }
+    
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * _count + 0.5);
+    target = std::max<uint64_t>(1, std::min(target, _count));
+    
+    uint64_t seen = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        seen += _buckets[i];
+        if (seen >= target) {
+            return std::min(bucketUpperBound(i), _max);
+        }
+    }
+    
+    return _max;
+}
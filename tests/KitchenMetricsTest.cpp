@@ -0,0 +1,54 @@
+#include "core/KitchenMetrics.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+    const int INTERVAL_MS = 100;
+    const int MIN_BUSY_PERMILLE = 800;
+    const int MAX_IDLE_PERMILLE = 200;
+    const int MIN_OVERALL_PERMILLE = 550;
+    const int MAX_OVERALL_PERMILLE = 750;
+    
+    void waitInterval() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(INTERVAL_MS));
+    }
+    
+    bool expectUtilization(const std::string& interval, int permille, int minimum, int maximum) {
+        if (permille < minimum || permille > maximum) {
+            std::cerr << "KitchenMetricsTest: " << interval << " utilization " << permille / 10.0
+                      << "%, expected between " << minimum / 10.0 << "% and " << maximum / 10.0 << "%" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int main() {
+    KitchenMetrics metrics(1);
+    metrics.start();
+    
+    auto startedAt = std::chrono::steady_clock::now();
+    metrics.recordCookStart();
+    waitInterval();
+    KitchenMetricsSnapshot cooking = metrics.report(1);
+    
+    waitInterval();
+    metrics.recordCook(OvenShard, std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startedAt).count());
+    KitchenMetricsSnapshot finished = metrics.report(1);
+    
+    waitInterval();
+    KitchenMetricsSnapshot idle = metrics.report(1);
+    
+    if (!expectUtilization("mid-cook", cooking.recentUtilization, MIN_BUSY_PERMILLE, 1000) ||
+        !expectUtilization("finishing", finished.recentUtilization, MIN_BUSY_PERMILLE, 1000) ||
+        !expectUtilization("idle", idle.recentUtilization, 0, MAX_IDLE_PERMILLE) ||
+        !expectUtilization("overall", idle.utilization, MIN_OVERALL_PERMILLE, MAX_OVERALL_PERMILLE)) {
+        return 1;
+    }
+    
+    std::cout << "KitchenMetricsTest: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "core/Kitchen.hpp"
+#include "ipc/IPCFactory.hpp"
+#include "utils/Logger.hpp"
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    const int STATUS_WINDOW_MS = 200;
+    const int COOKING_TIME_MS = 30;
+    
+    struct KitchenView {
+        KitchenStatus status;
+        KitchenStatus reply;
+        uint32_t replyId;
+    };
+    
+    void pump(IIPC& ipc, KitchenView& view, int durationMs, uint32_t awaitedReply = 0, bool applyReply = true) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(durationMs);
+        IPCMessage message;
+        
+        while (std::chrono::steady_clock::now() < deadline && (awaitedReply == 0 || view.replyId != awaitedReply)) {
+            struct pollfd pollFd = {ipc.getReadFd(), POLLIN, 0};
+            poll(&pollFd, 1, 5);
+            
+            while (ipc.receive(message)) {
+                if (message.getType() == StatusMessage) {
+                    KitchenStatus status;
+                    status.unpack(message.getPayload(), message.getPayloadSize());
+                    if (message.getCorrelationId() == 0 || applyReply) {
+                        view.status = status;
+                    }
+                    if (message.getCorrelationId() != 0) {
+                        view.reply = status;
+                        view.replyId = message.getCorrelationId();
+                    }
+                } else if (message.getType() == StatusDeltaMessage) {
+                    StatusDelta delta;
+                    delta.unpack(message.getPayload(), message.getPayloadSize());
+                    delta.applyTo(view.status);
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    Logger::getInstance().enableConsoleOutput(false);
+    
+    auto kitchen = std::make_unique<Kitchen>(1, 1, 1.0, 10000, FifoScheduling, STATUS_WINDOW_MS);
+    auto ipc = IPCFactory::createIPC(PipeTransport);
+    if (!ipc->create()) {
+        std::cerr << "failed to create IPC channel" << std::endl;
+        return 1;
+    }
+    
+    pid_t pid = fork();
+    if (pid == 0) {
+        ipc->setupChild();
+        kitchen->setIPC(std::move(ipc));
+        kitchen->runAsChildProcess();
+        _exit(0);
+    }
+    
+    ipc->setupParent();
+    KitchenView view = {};
+    pump(*ipc, view, 100);
+    
+    ipc->send(IPCMessage::encode(PizzaMessage, SerializedPizza(Margarita, S, COOKING_TIME_MS)));
+    pump(*ipc, view, 10);
+    ipc->send(IPCMessage::encode(StatusRequestMessage, 1));
+    pump(*ipc, view, 500, 1);
+    pump(*ipc, view, 2 * STATUS_WINDOW_MS);
+    
+    ipc->send(IPCMessage::encode(StatusRequestMessage, 2));
+    pump(*ipc, view, 500, 2, false);
+    
+    kill(pid, SIGTERM);
+    waitpid(pid, nullptr, 0);
+    
+    if (view.replyId != 2) {
+        std::cerr << "StatusDeltaTest: kitchen did not answer the status request" << std::endl;
+        return 1;
+    }
+    if (!StatusDelta::between(view.status, view.reply).empty()) {
+        std::cerr << "StatusDeltaTest: pushed view diverged after a correlated reply (active cooks "
+                  << view.status.activeCooks << ", kitchen reports " << view.reply.activeCooks << ")" << std::endl;
+        return 1;
+    }
+    
+    std::cout << "StatusDeltaTest: OK" << std::endl;
+    return 0;
+}
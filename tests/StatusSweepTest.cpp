@@ -0,0 +1,133 @@
+#include "core/KitchenManager.hpp"
+#include "utils/Logger.hpp"
+#include <unistd.h>
+#include <signal.h>
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    const int KITCHENS = 8;
+    const int REPLY_DELAY_MS = 100;
+    
+    using Clock = std::chrono::steady_clock;
+    
+    long long elapsedMs(Clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+    }
+    
+    std::vector<pid_t> findKitchenPids() {
+        std::ifstream children("/proc/self/task/" + std::to_string(getpid()) + "/children");
+        std::vector<pid_t> pids;
+        pid_t pid;
+        
+        while (children >> pid) {
+            pids.push_back(pid);
+        }
+        return pids;
+    }
+    
+    std::thread delayReplies(const std::vector<pid_t>& pids) {
+        for (pid_t pid : pids) {
+            kill(pid, SIGSTOP);
+        }
+        
+        return std::thread([pids]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(REPLY_DELAY_MS));
+            for (pid_t pid : pids) {
+                kill(pid, SIGCONT);
+            }
+        });
+    }
+    
+    bool checkSweepTime(const std::string& api, long long elapsed) {
+        std::cout << "StatusSweepTest: " << api << " answered " << KITCHENS << " kitchens in "
+                  << elapsed << "ms with a " << REPLY_DELAY_MS << "ms round trip" << std::endl;
+        
+        if (elapsed >= 2 * REPLY_DELAY_MS) {
+            std::cerr << "StatusSweepTest: " << api << " took more than one round trip" << std::endl;
+            return false;
+        }
+        return true;
+    }
+    
+    bool sweepWithFutures(KitchenManager& manager, const std::vector<pid_t>& pids) {
+        std::thread resume = delayReplies(pids);
+        auto start = Clock::now();
+        
+        std::vector<std::future<KitchenStatus>> replies;
+        for (int kitchenId = 1; kitchenId <= KITCHENS; ++kitchenId) {
+            replies.push_back(manager.requestKitchenStatus(kitchenId));
+        }
+        
+        bool answered = true;
+        for (int kitchenId = 1; kitchenId <= KITCHENS; ++kitchenId) {
+            try {
+                KitchenStatus status = replies[kitchenId - 1].get();
+                if (status.kitchenId != kitchenId) {
+                    std::cerr << "StatusSweepTest: kitchen " << kitchenId << " answered as kitchen "
+                              << status.kitchenId << std::endl;
+                    answered = false;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "StatusSweepTest: " << e.what() << std::endl;
+                answered = false;
+            }
+        }
+        
+        long long elapsed = elapsedMs(start);
+        resume.join();
+        return answered && checkSweepTime("futures", elapsed);
+    }
+    
+    bool sweepWithCollect(KitchenManager& manager, const std::vector<pid_t>& pids) {
+        std::thread resume = delayReplies(pids);
+        auto start = Clock::now();
+        
+        size_t statuses = manager.collectKitchenStatuses().size();
+        
+        long long elapsed = elapsedMs(start);
+        resume.join();
+        
+        if (statuses != static_cast<size_t>(KITCHENS)) {
+            std::cerr << "StatusSweepTest: sweep returned " << statuses << " kitchens" << std::endl;
+            return false;
+        }
+        return checkSweepTime("collectKitchenStatuses", elapsed);
+    }
+}
+
+int main() {
+    Logger::getInstance().enableConsoleOutput(false);
+    
+    char logDirectory[] = "/tmp/plazza_status_sweep_XXXXXX";
+    if (!mkdtemp(logDirectory) || chdir(logDirectory) == -1) {
+        std::cerr << "StatusSweepTest: failed to create a log directory" << std::endl;
+        return 1;
+    }
+    
+    KitchenManager manager(1, 1.0, 10000, PipeTransport, FifoScheduling, DEFAULT_STATUS_WINDOW_MS, 0);
+    for (int i = 0; i < KITCHENS; ++i) {
+        manager.createNewKitchen();
+    }
+    manager.collectKitchenStatuses();
+    
+    std::vector<pid_t> pids = findKitchenPids();
+    if (pids.size() != static_cast<size_t>(KITCHENS)) {
+        std::cerr << "StatusSweepTest: expected " << KITCHENS << " kitchen processes, found "
+                  << pids.size() << std::endl;
+        return 1;
+    }
+    
+    if (!sweepWithFutures(manager, pids) || !sweepWithCollect(manager, pids)) {
+        return 1;
+    }
+    
+    std::cout << "StatusSweepTest: OK" << std::endl;
+    return 0;
+}